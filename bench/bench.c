@@ -0,0 +1,118 @@
+/******************************************************************************
+ * Cycles-per-byte benchmark for a single backend directory.
+ * 
+ * Built against the sources of one implementation directory (see 'run.sh'),
+ * it measures the median number of cycles of 'crypto_aead_encrypt' and
+ * 'crypto_aead_decrypt' (or 'crypto_hash' if BENCH_HASH is defined) over the
+ * eBACS-like message length grid, with and without associated data, and
+ * prints the results as a JSON object on the standard output.
+ * 
+ * Usage: ./bench <backend name> [number of runs per length]
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "cycles.h"
+#if defined(BENCH_HASH)
+#include "crypto_hash.h"
+#else
+#include "crypto_aead.h"
+#endif
+
+#define MAXLEN      16384
+#define TAGBYTES    16
+#define DEFAULT_RUNS 101
+
+static const unsigned long long lengths[] = {
+    0, 1, 8, 16, 32, 64, 128, 256, 512, 576, 1024, 1536, 2048, 4096, 8192, 16384
+};
+
+static unsigned char m[MAXLEN], ad[MAXLEN], c[MAXLEN + TAGBYTES];
+static unsigned char k[32], npub[32];
+static uint64_t samples[1024];
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static uint64_t median(uint64_t *t, int n)
+{
+    qsort(t, n, sizeof(uint64_t), cmp_u64);
+    return t[n/2];
+}
+
+static void print_result(int *first, const char *op,
+    unsigned long long mlen, unsigned long long adlen, uint64_t cycles)
+{
+    printf("%s\n    {\"op\": \"%s\", \"mlen\": %llu, \"adlen\": %llu, "
+        "\"cycles\": %llu, ", *first ? "" : ",", op, mlen, adlen,
+        (unsigned long long)cycles);
+    if (mlen + adlen == 0)
+        printf("\"cpb\": null}");
+    else
+        printf("\"cpb\": %.2f}", (double)cycles / (double)(mlen + adlen));
+    *first = 0;
+}
+
+int main(int argc, char *argv[])
+{
+    int i, r, runs, first = 1;
+    unsigned long long mlen;
+    uint64_t t;
+    const char *name = (argc > 1) ? argv[1] : "unknown";
+
+    runs = (argc > 2) ? atoi(argv[2]) : DEFAULT_RUNS;
+    if (runs < 1 || runs > (int)(sizeof(samples)/sizeof(samples[0])))
+        runs = DEFAULT_RUNS;
+    for(i = 0; i < MAXLEN; i++) {
+        m[i] = (unsigned char)i;
+        ad[i] = (unsigned char)(i ^ 0x5a);
+    }
+    cycles_init();
+    printf("{\"name\": \"%s\", \"kind\": \"%s\", \"counter\": \"%s\", "
+        "\"runs\": %d, \"results\": [", name,
+#if defined(BENCH_HASH)
+        "hash",
+#else
+        "aead",
+#endif
+        cycles_source(), runs);
+    for(i = 0; i < (int)(sizeof(lengths)/sizeof(lengths[0])); i++) {
+        mlen = lengths[i];
+#if defined(BENCH_HASH)
+        for(r = 0; r < runs; r++) {
+            t = cycles_read();
+            crypto_hash(c, m, mlen);
+            samples[r] = cycles_read() - t;
+        }
+        print_result(&first, "hash", mlen, 0, median(samples, runs));
+#else
+        unsigned long long adlen, clen, outlen;
+        int with_ad;
+        for(with_ad = 0; with_ad < 2; with_ad++) {
+            adlen = with_ad ? mlen : 0;
+            if (with_ad && adlen == 0)
+                continue;
+            for(r = 0; r < runs; r++) {
+                t = cycles_read();
+                crypto_aead_encrypt(c, &clen, m, mlen, ad, adlen, NULL, npub, k);
+                samples[r] = cycles_read() - t;
+            }
+            print_result(&first, "encrypt", mlen, adlen, median(samples, runs));
+            for(r = 0; r < runs; r++) {
+                t = cycles_read();
+                if (crypto_aead_decrypt(m, &outlen, NULL, c, clen, ad, adlen,
+                        npub, k) != 0) {
+                    fprintf(stderr, "%s: decryption failed\n", name);
+                    return 1;
+                }
+                samples[r] = cycles_read() - t;
+            }
+            print_result(&first, "decrypt", mlen, adlen, median(samples, runs));
+        }
+#endif
+    }
+    printf("\n]}\n");
+    return 0;
+}
@@ -0,0 +1,140 @@
+/******************************************************************************
+* Calibration of the Romulus cost model (see 'romulus_cost.h') for a single
+* backend directory.
+*
+* Measures the median cycle count of encryption (or hashing) over a grid of
+* (adlen, mlen) and fits, by least squares, the cycles per Skinny call, per
+* TK2/TK3 and TK3 schedule expansions, per byte and per call. The resulting
+* 'romulus_cost_model' is printed as a JSON object along with the fit error.
+*
+* Usage: ./cost <backend name>
+* Built with -DCOST_VARIANT=ROMULUS_N/M/T/H (and -DCOST_HASH for Romulus-H).
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "cycles.h"
+#include "romulus_cost.h"
+#ifdef COST_HASH
+#include "crypto_hash.h"
+#else
+#include "crypto_aead.h"
+#endif
+
+#define RUNS        31
+#define NFEATURES   5
+#define MAXLEN      4096
+
+static const unsigned long long grid[] = {
+    0, 1, 15, 16, 17, 31, 32, 33, 48, 64, 100, 128, 200, 256, 512, 1024, 4096
+};
+#define NGRID       (sizeof(grid)/sizeof(grid[0]))
+
+static unsigned char m[MAXLEN], ad[MAXLEN], c[MAXLEN + 32];
+static unsigned char k[32], npub[32];
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static double measure(unsigned long long adlen, unsigned long long mlen)
+{
+    uint64_t t[RUNS];
+    unsigned long long clen;
+    for(int r = 0; r < RUNS; r++) {
+        t[r] = cycles_read();
+#ifdef COST_HASH
+        crypto_hash(c, m, mlen);
+        (void)clen; (void)adlen;
+#else
+        crypto_aead_encrypt(c, &clen, m, mlen, ad, adlen, NULL, npub, k);
+#endif
+        t[r] = cycles_read() - t[r];
+    }
+    qsort(t, RUNS, sizeof(uint64_t), cmp_u64);
+    return (double)t[RUNS/2];
+}
+
+static void features(double *x, unsigned long long adlen, unsigned long long mlen)
+{
+    romulus_cost_t cost = romulus_cost(COST_VARIANT, adlen, mlen);
+    x[0] = (double)cost.skinny;
+    x[1] = (double)cost.tk_schedule_23;
+    x[2] = (double)cost.tk_schedule_3;
+    x[3] = (double)(adlen + mlen);
+    x[4] = 1.0;
+}
+
+/**
+ * Solve (X^T W X + lambda I) w = X^T W y by Gaussian elimination, with W the
+ * diagonal matrix of 1/y^2 so that the relative error is minimized (short
+ * inputs would be irrelevant otherwise). The small ridge term keeps the system
+ * well-defined when features are collinear (e.g. Skinny calls and schedule
+ * expansions in Romulus-H).
+ */
+static void fit(double *w, double x[][NFEATURES], const double *y, int n)
+{
+    double a[NFEATURES][NFEATURES+1] = {{0}};
+    double trace = 0;
+    int i, j, l;
+    for(l = 0; l < n; l++) {
+        double wl = 1.0 / (y[l] * y[l]);
+        for(i = 0; i < NFEATURES; i++) {
+            for(j = 0; j < NFEATURES; j++)
+                a[i][j] += wl * x[l][i] * x[l][j];
+            a[i][NFEATURES] += wl * x[l][i] * y[l];
+        }
+    }
+    for(i = 0; i < NFEATURES; i++)
+        trace += a[i][i];
+    for(i = 0; i < NFEATURES; i++)
+        a[i][i] += 1e-9 * trace;
+    for(i = 0; i < NFEATURES; i++) {
+        for(j = i + 1; j < NFEATURES; j++) {
+            double f = a[j][i] / a[i][i];
+            for(l = i; l <= NFEATURES; l++)
+                a[j][l] -= f * a[i][l];
+        }
+    }
+    for(i = NFEATURES - 1; i >= 0; i--) {
+        w[i] = a[i][NFEATURES];
+        for(j = i + 1; j < NFEATURES; j++)
+            w[i] -= a[i][j] * w[j];
+        w[i] /= a[i][i];
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    static double x[NGRID*NGRID][NFEATURES], y[NGRID*NGRID];
+    double w[NFEATURES], err = 0, maxerr = 0;
+    int n = 0;
+    const char *name = (argc > 1) ? argv[1] : "unknown";
+    cycles_init();
+    for(unsigned i = 0; i < NGRID; i++) {
+        for(unsigned j = 0; j < NGRID; j++) {
+            unsigned long long adlen = grid[i], mlen = grid[j];
+            if (COST_VARIANT == ROMULUS_H && adlen != 0)
+                continue;
+            features(x[n], adlen, mlen);
+            y[n++] = measure(adlen, mlen);
+        }
+    }
+    fit(w, x, y, n);
+    for(int l = 0; l < n; l++) {
+        double p = 0, e;
+        for(int i = 0; i < NFEATURES; i++)
+            p += w[i] * x[l][i];
+        e = fabs(p - y[l]) / y[l];
+        err += e / n;
+        if (e > maxerr)
+            maxerr = e;
+    }
+    printf("{\"name\": \"%s\", \"counter\": \"%s\", \"model\": {\"skinny\": %.1f, "
+        "\"tk_schedule_23\": %.1f, \"tk_schedule_3\": %.1f, \"per_byte\": %.2f, "
+        "\"per_call\": %.1f}, \"mean_rel_error\": %.4f, \"max_rel_error\": %.4f}\n",
+        name, cycles_source(), w[0], w[1], w[2], w[3], w[4], err, maxerr);
+    return 0;
+}
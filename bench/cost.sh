@@ -0,0 +1,57 @@
+#!/bin/sh
+# Calibration of the Romulus cost model for each backend.
+#
+# Builds 'cost.c' against every Romulus implementation directory which can run
+# on the host (or the directories given as arguments) and prints a JSON array
+# of the fitted 'romulus_cost_model' coefficients, in cycles.
+# 'CC' and 'CFLAGS' can be overridden.
+
+cd "$(dirname "$0")" || exit 1
+ROOT=..
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:-"-O3"}
+STATS=$ROOT/crypto_tbc/skinny128/stats
+BUILD=$(mktemp -d)
+trap 'rm -rf "$BUILD"' EXIT
+
+case "$(uname -m)" in
+    x86_64|i?86)    ARCH_BACKENDS="x86";            ARCH_FLAGS="-mssse3";;
+    aarch64|arm64)  ARCH_BACKENDS="armv8a/precalculate"; ARCH_FLAGS="";;
+    armv7*)         ARCH_BACKENDS="armv7a";         ARCH_FLAGS="-mfpu=neon";;
+    *)              ARCH_BACKENDS="";               ARCH_FLAGS="";;
+esac
+if [ $# -eq 0 ]; then
+    for v in crypto_aead/romulus-n crypto_aead/romulus-m crypto_aead/romulus-t \
+            crypto_hash/romulus-h; do
+        for b in opt32 $ARCH_BACKENDS; do
+            [ -d "$ROOT/$v/$b" ] && set -- "$@" "$v/$b"
+        done
+    done
+fi
+
+printf '['
+sep=""
+for dir in "$@"; do
+    src="$ROOT/$dir"
+    case "$dir" in
+        *romulus-n*)    variant=ROMULUS_N;;
+        *romulus-m*)    variant=ROMULUS_M;;
+        *romulus-t*)    variant=ROMULUS_T;;
+        *romulus-h*)    variant="ROMULUS_H -DCOST_HASH";;
+        *)              echo "skipping $dir (unknown variant)" >&2; continue;;
+    esac
+    files=$(ls "$src"/*.c "$src"/*.S "$src"/*.s 2>/dev/null)
+    [ "${variant#ROMULUS_H}" != "$variant" ] || files=$(echo "$files" | grep -v '/hash\.c$')
+    bin="$BUILD/cost_$(echo "$dir" | tr '/' '_')"
+    if ! $CC $CFLAGS $ARCH_FLAGS -DCOST_VARIANT=$variant -I. -I"$STATS" \
+            -I"$src" cost.c "$STATS/romulus_cost.c" $files -lm -o "$bin" \
+            2>"$bin.log"; then
+        echo "skipping $dir (build failed)" >&2
+        head -n 5 "$bin.log" >&2
+        continue
+    fi
+    printf '%s\n' "$sep"
+    "$bin" "$dir" | tr -d '\n'
+    sep=","
+done
+printf '\n]\n'
@@ -0,0 +1,69 @@
+/******************************************************************************
+ * Cycle counter used by the benchmarks.
+ * 
+ * On x86 the time-stamp counter is read with 'rdtsc'. On other Linux targets
+ * the hardware cycle counter is read through 'perf_event_open', and if it is
+ * not available (e.g. restricted by 'perf_event_paranoid') we fall back to the
+ * monotonic clock in nanoseconds, which is reported as such in the output.
+ *****************************************************************************/
+#ifndef CYCLES_H_
+#define CYCLES_H_
+
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+
+static const char *cycles_source(void) { return "rdtsc"; }
+static void cycles_init(void) {}
+static inline uint64_t cycles_read(void) { return __rdtsc(); }
+
+#else
+#include <time.h>
+#if defined(__linux__)
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+static int cycles_fd = -1;
+
+static const char *cycles_source(void)
+{
+    return (cycles_fd >= 0) ? "perf_event" : "clock_ns";
+}
+
+static void cycles_init(void)
+{
+#if defined(__linux__)
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    cycles_fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    if (cycles_fd >= 0) {
+        ioctl(cycles_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(cycles_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+static inline uint64_t cycles_read(void)
+{
+    struct timespec ts;
+#if defined(__linux__)
+    uint64_t c;
+    if (cycles_fd >= 0 && read(cycles_fd, &c, sizeof(c)) == sizeof(c))
+        return c;
+#endif
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+#endif
+
+#endif  // CYCLES_H_
@@ -0,0 +1,207 @@
+/******************************************************************************
+ * Latency vs throughput microbenchmark of the Skinny-128-384+ kernels.
+ * 
+ * The kernel is selected at compile time (see 'kernels.sh'). Round tweakeys are
+ * precomputed once so that only the encryption core is measured, then:
+ *  - latency: each call takes the output of the previous one as input (i.e. the
+ *    dependency chain of the sequential Romulus modes);
+ *  - throughput: 1/2/4/8 independent chains are updated in a round-robin way so
+ *    that the out-of-order engine may overlap consecutive calls.
+ * Kernels providing 2-way (resp. 3-way) interleaved routines are also measured
+ * through them, with 2/4/8 (resp. 3/6) chains.
+ * Kernels processing several blocks per call (see 'blocks' in the output) are
+ * measured the same way, cycles being divided by the number of blocks (i.e. the
+ * latency of a call is 'blocks' times the reported latency).
+ * Results are given in cycles per round as a JSON object.
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "cycles.h"
+
+#if defined(KERNEL_SIMD_X86_VBMI)
+#define KERNEL_SIMD_X86
+#endif
+#if defined(KERNEL_BITSLICED_SSE_GFNI)
+#define KERNEL_BITSLICED_SSE
+#endif
+
+#if defined(KERNEL_SIMD_X86) || defined(KERNEL_ROMULUS_X86)
+#include "skinny128.h"
+#define ROUNDS          SKINNY128_384_ROUNDS
+static uint8_t rtk_23[SKINNY128_384_ROUNDS*BLOCKBYTES/2];
+static uint8_t tk1[TWEAKEYBYTES] = {0x01};
+#define SETUP()         tk_schedule_23(rtk_23, key, key + 16)
+#define ENC(out, in)    skinny128_384_plus(out, in, tk1, rtk_23)
+#define ENC_X2(out_0, in_0, out_1, in_1) \
+    skinny128_384_plus_x2(out_0, in_0, tk1, rtk_23, out_1, in_1, tk1, rtk_23)
+#if defined(KERNEL_ROMULUS_X86)
+#define KERNEL_NAME     "crypto_aead/romulus-n/x86"
+#else
+#if defined(KERNEL_SIMD_X86_VBMI)
+#define KERNEL_NAME     "crypto_tbc/skinny128/simd/x86 (avx512vbmi)"
+#else
+#define KERNEL_NAME     "crypto_tbc/skinny128/simd/x86"
+#endif
+#define ENC_X3(out_0, in_0, out_1, in_1, out_2, in_2)   \
+    skinny128_384_plus_x3(out_0, in_0, tk1, rtk_23,     \
+        out_1, in_1, tk1, rtk_23, out_2, in_2, tk1, rtk_23)
+#endif
+
+#elif defined(KERNEL_BITSLICED_SSE)
+#include "skinny128.h"
+#if defined(KERNEL_BITSLICED_SSE_GFNI)
+#define KERNEL_NAME     "crypto_tbc/skinny128/bitsliced/1_block/sse (gfni)"
+#else
+#define KERNEL_NAME     "crypto_tbc/skinny128/bitsliced/1_block/sse"
+#endif
+#define ROUNDS          SKINNY128_384_PLUS_ROUNDS
+static __m128i rtk[SKINNY128_384_PLUS_ROUNDS];
+static tweakey tk;
+#define SETUP() ({                                                  \
+    for(int j = 0; j < 16; j++) {                                   \
+        tk.tk1[j] = 0; tk.tk2[j] = key[j]; tk.tk3[j] = key[16+j];   \
+    }                                                               \
+    precompute_rtk_plus(rtk, &tk);                                  \
+})
+#define ENC(out, in)    core_skinny128_enc(out, in, rtk, ROUNDS)
+
+#elif defined(KERNEL_BITSLICED_AVX2)
+#include "skinny128.h"
+#define KERNEL_NAME     "crypto_tbc/skinny128/bitsliced/2_blocks/avx2"
+#define ROUNDS          SKINNY128_384_PLUS_ROUNDS
+#define BLOCKS          2
+static __m128i rtk[SKINNY128_384_PLUS_ROUNDS];
+static tweakey tk;
+#define SETUP() ({                                                  \
+    for(int j = 0; j < 16; j++) {                                   \
+        tk.tk1[j] = 0; tk.tk2[j] = key[j]; tk.tk3[j] = key[16+j];   \
+    }                                                               \
+    precompute_rtk_plus(rtk, &tk);                                  \
+})
+#define ENC(out, in)    core_skinny128_enc_x2(out, in, rtk, ROUNDS)
+
+#elif defined(KERNEL_BITSLICED_AVX512)
+#include "skinny128.h"
+#define KERNEL_NAME     "crypto_tbc/skinny128/bitsliced/4_blocks/avx512"
+#define ROUNDS          SKINNY128_384_PLUS_ROUNDS
+#define BLOCKS          4
+static __m512i rtk[SKINNY128_384_PLUS_ROUNDS];
+static tweakey tk[BLOCKS];
+#define SETUP() ({                                                  \
+    for(int b = 0; b < BLOCKS; b++)                                 \
+        for(int j = 0; j < 16; j++) {                               \
+            tk[b].tk1[j] = b; tk[b].tk2[j] = key[j];                \
+            tk[b].tk3[j] = key[16+j];                               \
+        }                                                           \
+    precompute_rtk_plus_x4(rtk, tk);                                \
+})
+#define ENC(out, in)    core_skinny128_enc_x4(out, in, rtk, ROUNDS)
+
+#elif defined(KERNEL_OPT32)
+#include "skinny128.h"
+#include "tk_schedule.h"
+#define KERNEL_NAME     "crypto_aead/romulus-n/opt32"
+#define ROUNDS          SKINNY128_384_ROUNDS
+static uint32_t rtk_1[RTK1_WORDS];
+static uint32_t rtk_23[RTK23_WORDS];
+static uint8_t tk1[16] = {0x01};
+#define SETUP()         tk_schedule_123(rtk_1, rtk_23, tk1, key, key + 16)
+#define ENC(out, in)    skinny128_384_plus(out, in, rtk_1, rtk_23)
+
+#else
+#error "no kernel selected"
+#endif
+
+// number of blocks processed by a single call
+#if !defined(BLOCKS)
+#define BLOCKS      1
+#endif
+
+#define CALLS       1000
+#define REPS        11
+#define MAXCHAINS   8
+
+static uint8_t key[32];
+static uint8_t x[MAXCHAINS][16*BLOCKS];
+static uint64_t samples[REPS];
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t u = *(const uint64_t *)a, v = *(const uint64_t *)b;
+    return (u > v) - (u < v);
+}
+
+/**
+ * Median number of cycles per round over REPS runs of CALLS calls on each of
+ * the 'chains' independent chains, processed 'lanes' at a time through the
+ * interleaved routines if 'lanes' is 2 or 3.
+ */
+static double measure(int chains, int lanes)
+{
+    int i, j, r;
+    uint64_t t;
+    for(r = 0; r < REPS; r++) {
+        t = cycles_read();
+        for(i = 0; i < CALLS; i++) {
+#if defined(ENC_X2)
+            if (lanes == 2) {
+                for(j = 0; j < chains; j += 2)
+                    ENC_X2(x[j], x[j], x[j+1], x[j+1]);
+                continue;
+            }
+#endif
+#if defined(ENC_X3)
+            if (lanes == 3) {
+                for(j = 0; j < chains; j += 3)
+                    ENC_X3(x[j], x[j], x[j+1], x[j+1], x[j+2], x[j+2]);
+                continue;
+            }
+#endif
+            for(j = 0; j < chains; j++)
+                ENC(x[j], x[j]);
+        }
+        samples[r] = cycles_read() - t;
+    }
+    (void)lanes;
+    qsort(samples, REPS, sizeof(uint64_t), cmp_u64);
+    return (double)samples[REPS/2] / ((double)CALLS * chains * ROUNDS * BLOCKS);
+}
+
+int main(void)
+{
+    int chains, i;
+    for(i = 0; i < 32; i++)
+        key[i] = (uint8_t)(i * 29 + 1);
+    for(i = 0; i < MAXCHAINS * 16 * BLOCKS; i++)
+        x[i / (16*BLOCKS)][i % (16*BLOCKS)] = (uint8_t)i;
+    cycles_init();
+    SETUP();
+    measure(1, 0);      // warm-up
+    printf("{\"kernel\": \"%s\", \"counter\": \"%s\", \"rounds\": %d, "
+        "\"blocks\": %d,\n", KERNEL_NAME, cycles_source(), ROUNDS, BLOCKS);
+    printf("  \"latency_cpr\": %.2f,\n  \"throughput_cpr\": {", measure(1, 0));
+    for(chains = 1; chains <= MAXCHAINS; chains *= 2)
+        printf("%s\"%d\": %.2f", chains > 1 ? ", " : "", chains,
+            measure(chains, 0));
+    printf("}");
+#if defined(ENC_X2)
+    printf(",\n  \"interleaved_x2_cpr\": {");
+    for(chains = 2; chains <= MAXCHAINS; chains *= 2)
+        printf("%s\"%d\": %.2f", chains > 2 ? ", " : "", chains,
+            measure(chains, 2));
+    printf("}");
+#endif
+#if defined(ENC_X3)
+    printf(",\n  \"interleaved_x3_cpr\": {");
+    for(chains = 3; chains <= MAXCHAINS; chains += 3)
+        printf("%s\"%d\": %.2f", chains > 3 ? ", " : "", chains,
+            measure(chains, 3));
+    printf("}");
+#endif
+    // keep the outputs alive
+    for(i = 0; i < MAXCHAINS; i++)
+        key[0] ^= x[i][0];
+    printf(",\n  \"checksum\": %u\n}\n", key[0]);
+    return 0;
+}
@@ -0,0 +1,60 @@
+#!/bin/sh
+# Latency vs throughput microbenchmark of the Skinny-128-384+ kernels.
+#
+# Builds 'kernels.c' for every kernel that can run on the host and prints a
+# JSON array with, for each one, the latency of a single dependent chain and
+# the throughput with 1/2/4/8 independent chains in flight (cycles per round).
+# 'CC' and 'CFLAGS' can be overridden. Kernels relying on instructions which
+# are not supported by the host are skipped, unless they are run through an
+# emulator given in 'SDE' (e.g. SDE="sde64 -icl --").
+
+cd "$(dirname "$0")" || exit 1
+ROOT=..
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:-"-O3"}
+BUILD=$(mktemp -d)
+trap 'rm -rf "$BUILD"' EXIT
+
+# <define>:<source directory>[:<additional flags, comma-separated>]
+KERNELS="KERNEL_OPT32:crypto_aead/romulus-n/opt32"
+case "$(uname -m)" in
+    x86_64|i?86)
+        ARCH_FLAGS="-mssse3"
+        KERNELS="$KERNELS KERNEL_SIMD_X86:crypto_tbc/skinny128/simd/x86
+            KERNEL_SIMD_X86_VBMI:crypto_tbc/skinny128/simd/x86:-mavx512vbmi,-DSKINNY_SBOX_VBMI
+            KERNEL_ROMULUS_X86:crypto_aead/romulus-n/x86
+            KERNEL_BITSLICED_SSE:crypto_tbc/skinny128/bitsliced/1_block/sse
+            KERNEL_BITSLICED_SSE_GFNI:crypto_tbc/skinny128/bitsliced/1_block/sse:-mgfni,-DSKINNY_GFNI
+            KERNEL_BITSLICED_AVX2:crypto_tbc/skinny128/bitsliced/2_blocks/avx2:-mavx2
+            KERNEL_BITSLICED_AVX512:crypto_tbc/skinny128/bitsliced/4_blocks/avx512:-mavx512f,-mavx512bw";;
+    *)
+        ARCH_FLAGS="";;
+esac
+
+printf '['
+sep=""
+for k in $KERNELS; do
+    def=${k%%:*}
+    dir=${k#*:}
+    flag=""
+    case "$dir" in
+        *:*) flag=$(echo "${dir#*:}" | tr ',' ' '); dir=${dir%%:*};;
+    esac
+    src="$ROOT/$dir"
+    files="$src/skinny128.c"
+    [ -f "$src/tk_schedule.c" ] && files="$files $src/tk_schedule.c"
+    if ! $CC $CFLAGS $ARCH_FLAGS $flag -D"$def" -I. -I"$src" kernels.c $files \
+            -o "$BUILD/$def" 2>"$BUILD/$def.log"; then
+        echo "skipping $dir $flag (build failed)" >&2
+        head -n 5 "$BUILD/$def.log" >&2
+        continue
+    fi
+    if ! $SDE "$BUILD/$def" >"$BUILD/$def.json" 2>/dev/null; then
+        echo "skipping $dir $flag (not supported by the host)" >&2
+        continue
+    fi
+    printf '%s\n' "$sep"
+    cat "$BUILD/$def.json"
+    sep=","
+done
+printf ']\n'
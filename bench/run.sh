@@ -0,0 +1,94 @@
+#!/bin/sh
+# Cross-backend cycles-per-byte benchmark.
+#
+# Builds 'bench.c' against every implementation directory that can run on the
+# host (or against the directories given as arguments, relative to the root of
+# the repository) and prints a single JSON document on the standard output:
+#
+#   ./run.sh > results.json
+#   CC=clang CFLAGS="-O3 -march=native" RUNS=51 ./run.sh crypto_aead/romulus-n/x86
+#
+# The 'avx2' backends are additionally compiled with -mavx2. Backends which
+# fail to build or to run (e.g. 'avx2' on a host without AVX2) are reported on
+# stderr and skipped.
+
+cd "$(dirname "$0")" || exit 1
+ROOT=..
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:-"-O3"}
+RUNS=${RUNS:-101}
+BUILD=$(mktemp -d)
+trap 'rm -rf "$BUILD"' EXIT
+
+AEAD_VARIANTS="crypto_aead/romulus-n crypto_aead/romulus-m crypto_aead/romulus-t
+    crypto_aead_hash/romulus-n-h crypto_aead_hash/romulus-m-h
+    crypto_aead_hash/romulus-t-h"
+SKINNYAEAD_VARIANTS="crypto_aead/skinnyaead-m1 crypto_aead/skinnyaead-m1+"
+
+if [ $# -eq 0 ]; then
+    case "$(uname -m)" in
+        x86_64|i?86)    ARCH_BACKENDS="x86 avx2";       ARCH_FLAGS="-mssse3";
+                        SKINNYAEAD_BACKENDS="1_block/x86";;
+        aarch64|arm64)  ARCH_BACKENDS="armv8a/precalculate armv8a/onthefly";
+                        ARCH_FLAGS="";;
+        armv7*)         ARCH_BACKENDS="armv7a";         ARCH_FLAGS="-mfpu=neon";;
+        *)              ARCH_BACKENDS="";               ARCH_FLAGS="";;
+    esac
+    for v in $AEAD_VARIANTS crypto_hash/romulus-h; do
+        for b in opt32 opt32_redundant $ARCH_BACKENDS; do
+            [ -d "$ROOT/$v/$b" ] && set -- "$@" "$v/$b"
+        done
+    done
+    for v in $SKINNYAEAD_VARIANTS; do
+        for b in 1_block/opt32 2_blocks/opt32 $SKINNYAEAD_BACKENDS; do
+            [ -d "$ROOT/$v/$b" ] && set -- "$@" "$v/$b"
+        done
+    done
+else
+    case "$(uname -m)" in
+        x86_64|i?86)    ARCH_FLAGS="-mssse3";;
+        armv7*)         ARCH_FLAGS="-mfpu=neon";;
+        *)              ARCH_FLAGS="";;
+    esac
+fi
+
+json_str() {
+    printf '"%s"' "$(printf '%s' "$1" | tr -d '"\\' | tr '\n' ' ')"
+}
+
+CPU=$(grep -m1 'model name' /proc/cpuinfo 2>/dev/null | cut -d: -f2- | sed 's/^ *//')
+printf '{\n"host": {"machine": %s, "cpu": %s, "os": %s},\n' \
+    "$(json_str "$(uname -m)")" "$(json_str "${CPU:-unknown}")" \
+    "$(json_str "$(uname -sr)")"
+printf '"compiler": %s,\n"cflags": %s,\n"backends": [\n' \
+    "$(json_str "$($CC --version 2>/dev/null | head -n 1)")" \
+    "$(json_str "$CFLAGS $ARCH_FLAGS")"
+
+sep=""
+for dir in "$@"; do
+    src="$ROOT/$dir"
+    # AEAD+hash directories are built as a whole (including 'hash.c') so that
+    # a backend which does not link is reported, but only the AEAD is measured
+    files=$(ls "$src"/*.c "$src"/*.S "$src"/*.s 2>/dev/null)
+    if [ -f "$src/hash.c" ] && [ ! -f "$src/encrypt.c" ]; then
+        kind="-DBENCH_HASH"
+    else
+        kind=""
+    fi
+    case "$dir" in
+        */avx2)     DIR_FLAGS="-mavx2";;
+        *)          DIR_FLAGS="";;
+    esac
+    bin="$BUILD/bench_$(echo "$dir" | tr '/+' '__')"
+    if ! $CC $CFLAGS $ARCH_FLAGS $DIR_FLAGS $kind -I. -I"$src" bench.c $files \
+            -o "$bin" 2>"$bin.log"; then
+        echo "skipping $dir (build failed, see below)" >&2
+        head -n 5 "$bin.log" >&2
+        continue
+    fi
+    out=$("$bin" "$dir" "$RUNS") || { echo "skipping $dir (run failed)" >&2; continue; }
+    printf '%s%s' "$sep" "$out"
+    sep=",
+"
+done
+printf '\n]}\n'
@@ -0,0 +1,134 @@
+/******************************************************************************
+ * Throughput benchmark of the Skinny-128-256 sector encryption.
+ * 
+ * Built against one backend directory of 'crypto_tbc/skinny128/sector' (see
+ * 'sector.sh'), it reports as a JSON object:
+ *  - the median number of cycles per byte to encrypt/decrypt a single sector
+ *    of 512 B, 4 KiB and 64 KiB (in cache), on one thread;
+ *  - the throughput in MB/s (wall clock) of 'skinny_sector_encrypt_mt' on an
+ *    extent of EXTENT bytes made of 4 KiB sectors, for 1, 2, 4, ... threads up
+ *    to the number of online CPUs (or '-t threads').
+ * 
+ * Usage: ./sector [-t threads] [-n name]
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include "cycles.h"
+#include "skinny_sector.h"
+
+#define REPS        11
+#define CYCLE_BYTES (1 << 20)   // bytes processed per cycle sample
+#define EXTENT      (64 << 20)  // bytes of the multi-threaded extent
+#define MT_SECTOR   4096
+
+static const size_t sizes[] = {512, 4096, 65536};
+static uint64_t samples[REPS];
+static skinny_sector_key ctx;
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t u = *(const uint64_t *)a, v = *(const uint64_t *)b;
+    return (u > v) - (u < v);
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Median number of cycles per byte to process sectors of 'len' bytes.
+ */
+static double measure(unsigned char *buf, size_t len, int dec)
+{
+    uint64_t t, s;
+    int r;
+    for(r = 0; r < REPS; r++) {
+        t = cycles_read();
+        for(s = 0; s < CYCLE_BYTES / len; s++) {
+            if (dec)
+                skinny_sector_decrypt(&ctx, s, buf, len);
+            else
+                skinny_sector_encrypt(&ctx, s, buf, len);
+        }
+        samples[r] = cycles_read() - t;
+    }
+    qsort(samples, REPS, sizeof(uint64_t), cmp_u64);
+    return (double)samples[REPS/2] / (double)((CYCLE_BYTES / len) * len);
+}
+
+/**
+ * Median throughput (MB/s) of the multi-threaded encryption of the extent.
+ */
+static double measure_mt(unsigned char *extent, int threads)
+{
+    uint64_t t;
+    int r;
+    for(r = 0; r < REPS; r++) {
+        t = now_ns();
+        skinny_sector_encrypt_mt(&ctx, 0, MT_SECTOR, extent, EXTENT, threads);
+        samples[r] = now_ns() - t;
+    }
+    qsort(samples, REPS, sizeof(uint64_t), cmp_u64);
+    return (double)EXTENT * 1e3 / (double)samples[REPS/2];
+}
+
+int main(int argc, char *argv[])
+{
+    const char *name = "sector";
+    unsigned char key[SKINNY_SECTOR_KEYBYTES];
+    unsigned char *buf, *extent;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int threads, maxthreads = cpus > 0 ? (int)cpus : 1;
+    size_t i;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:n:")) != -1) {
+        switch (opt) {
+            case 't': maxthreads = atoi(optarg); break;
+            case 'n': name = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-t threads] [-n name]\n", argv[0]);
+                return 1;
+        }
+    }
+    if (maxthreads > SKINNY_SECTOR_MT_MAX)
+        maxthreads = SKINNY_SECTOR_MT_MAX;
+    buf = malloc(sizes[sizeof(sizes)/sizeof(sizes[0]) - 1]);
+    extent = malloc(EXTENT);
+    if (!buf || !extent)
+        return 1;
+    for(i = 0; i < sizeof(key); i++)
+        key[i] = (unsigned char)(i * 29 + 1);
+    memset(buf, 0x5a, sizes[sizeof(sizes)/sizeof(sizes[0]) - 1]);
+    memset(extent, 0xa5, EXTENT);
+    cycles_init();
+    skinny_sector_key_setup(&ctx, key);
+    measure(buf, sizes[0], 0);      // warm-up
+
+    printf("{\"impl\": \"%s\", \"counter\": \"%s\",\n", name, cycles_source());
+    printf("  \"encrypt_cpb\": {");
+    for(i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++)
+        printf("%s\"%zu\": %.2f", i ? ", " : "", sizes[i],
+            measure(buf, sizes[i], 0));
+    printf("},\n  \"decrypt_cpb\": {");
+    for(i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++)
+        printf("%s\"%zu\": %.2f", i ? ", " : "", sizes[i],
+            measure(buf, sizes[i], 1));
+    printf("},\n  \"mt_extent_bytes\": %d, \"mt_sector_bytes\": %d,\n",
+        EXTENT, MT_SECTOR);
+    printf("  \"mt_encrypt_mbps\": {");
+    for(threads = 1; threads <= maxthreads; threads *= 2)
+        printf("%s\"%d\": %.1f", threads > 1 ? ", " : "", threads,
+            measure_mt(extent, threads));
+    printf("},\n  \"checksum\": %u\n}\n", buf[0] ^ extent[0]);
+    free(buf);
+    free(extent);
+    return 0;
+}
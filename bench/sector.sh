@@ -0,0 +1,53 @@
+#!/bin/sh
+# Throughput benchmark of the Skinny-128-256 sector encryption backends.
+#
+# Builds 'sector.c' against every backend of 'crypto_tbc/skinny128/sector'
+# that can run on the host and prints a JSON array with, for each one, the
+# cycles per byte for 512 B, 4 KiB and 64 KiB sectors and the multi-threaded
+# throughput on a large extent. 'CC' and 'CFLAGS' can be overridden, and the
+# remaining arguments are forwarded to 'sector.c' (e.g. '-t 8').
+
+cd "$(dirname "$0")" || exit 1
+ROOT=..
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:-"-O3"}
+BUILD=$(mktemp -d)
+trap 'rm -rf "$BUILD"' EXIT
+
+# <name>:<source directory>[:<additional flags, comma-separated>]
+BACKENDS="opt32:crypto_tbc/skinny128/sector/opt32"
+case "$(uname -m)" in
+    x86_64|i?86)
+        ARCH_FLAGS="-mssse3"
+        BACKENDS="$BACKENDS x86:crypto_tbc/skinny128/sector/x86
+            avx2:crypto_tbc/skinny128/sector/x86:-mavx2";;
+    *)
+        ARCH_FLAGS="";;
+esac
+
+printf '['
+sep=""
+for b in $BACKENDS; do
+    name=${b%%:*}
+    dir=${b#*:}
+    flag=""
+    case "$dir" in
+        *:*) flag=$(echo "${dir#*:}" | tr ',' ' '); dir=${dir%%:*};;
+    esac
+    src="$ROOT/$dir"
+    if ! $CC $CFLAGS $ARCH_FLAGS $flag -pthread -I. -I"$src" sector.c \
+            "$src"/*.c -o "$BUILD/$name" 2>"$BUILD/$name.log"; then
+        echo "skipping $dir $flag (build failed)" >&2
+        head -n 5 "$BUILD/$name.log" >&2
+        continue
+    fi
+    if ! "$BUILD/$name" -n "$dir${flag:+ ($flag)}" "$@" >"$BUILD/$name.json" \
+            2>/dev/null; then
+        echo "skipping $dir $flag (not supported by the host)" >&2
+        continue
+    fi
+    printf '%s\n' "$sep"
+    cat "$BUILD/$name.json"
+    sep=","
+done
+printf ']\n'
@@ -0,0 +1,299 @@
+/******************************************************************************
+ * Trace replay benchmark for a single AEAD backend directory.
+ * 
+ * Replays a trace of (adlen, mlen, key-id) records through 'crypto_aead_encrypt'
+ * and 'crypto_aead_decrypt' with 1 or more threads and reports the throughput
+ * (messages/s, bytes/s) as well as the p50/p99/p999 per-call latency as a JSON
+ * object on the standard output.
+ * 
+ * The trace is either a CSV file with one 'adlen,mlen,keyid' record per line
+ * (lines starting with '#' or not starting with a digit are ignored) or, with
+ * '-b', a binary file of little-endian uint32 triplets (adlen, mlen, keyid).
+ * Without any trace file, '-g n' generates n records following a heavy-tailed
+ * distribution dominated by 20-200 byte messages.
+ * 
+ * Usage: ./trace [-b] [-t threads] [-r passes] [-n name] (-g n | trace_file)
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "crypto_aead.h"
+
+#define MAXLEN      (1 << 20)   // records above 1 MiB are clamped
+#define TAGBYTES    16
+#define NKEYS       256
+
+typedef struct {
+    uint32_t adlen;
+    uint32_t mlen;
+    uint32_t keyid;
+} record;
+
+typedef struct {
+    int tid;
+    int nthreads;
+    int passes;
+    const record *trace;
+    size_t ntrace;
+    uint64_t *lat_enc;      // per-call latencies (ns) of this thread
+    uint64_t *lat_dec;
+    size_t ncalls;
+    uint64_t bytes;
+    int failed;
+} worker;
+
+static unsigned char keys[NKEYS][32];
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static uint32_t clamp(uint32_t len)
+{
+    return (len > MAXLEN) ? MAXLEN : len;
+}
+
+/**
+ * Synthetic trace: 80% of 20-200 byte records, 15% up to 1.5 KiB and 5% with a
+ * Pareto tail up to 64 KiB. AD is 0-32 bytes (i.e. typical record headers).
+ */
+static record *generate_trace(size_t n)
+{
+    size_t i;
+    uint64_t x = 0x9e3779b97f4a7c15ULL;
+    record *t = malloc(n * sizeof(record));
+    if (t == NULL)
+        return NULL;
+    for(i = 0; i < n; i++) {
+        double u;
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        u = (double)(x >> 11) / 9007199254740992.0;
+        if (u < 0.80)
+            t[i].mlen = 20 + (uint32_t)(u / 0.80 * 180);
+        else if (u < 0.95)
+            t[i].mlen = 200 + (uint32_t)((u - 0.80) / 0.15 * 1300);
+        else
+            t[i].mlen = (uint32_t)(1500 / (1.0 - (u - 0.95) / 0.05 * 0.977));
+        t[i].adlen = (uint32_t)(x % 33);
+        t[i].keyid = (uint32_t)((x >> 32) % NKEYS);
+    }
+    return t;
+}
+
+static record *load_trace(const char *path, int binary, size_t *n)
+{
+    size_t cap = 1024;
+    record *t = malloc(cap * sizeof(record));
+    FILE *f = fopen(path, binary ? "rb" : "r");
+    char line[256];
+    unsigned char raw[12];
+    unsigned long a, m, kid;
+
+    *n = 0;
+    if (f == NULL || t == NULL) {
+        free(t);
+        if (f != NULL)
+            fclose(f);
+        return NULL;
+    }
+    for(;;) {
+        if (binary) {
+            if (fread(raw, 1, sizeof(raw), f) != sizeof(raw))
+                break;
+            a   = raw[0] | raw[1] << 8 | raw[2] << 16 | (unsigned long)raw[3] << 24;
+            m   = raw[4] | raw[5] << 8 | raw[6] << 16 | (unsigned long)raw[7] << 24;
+            kid = raw[8] | raw[9] << 8 | raw[10] << 16 | (unsigned long)raw[11] << 24;
+        } else {
+            if (fgets(line, sizeof(line), f) == NULL)
+                break;
+            if (line[0] < '0' || line[0] > '9')
+                continue;
+            kid = 0;
+            if (sscanf(line, "%lu,%lu,%lu", &a, &m, &kid) < 2)
+                continue;
+        }
+        if (*n == cap) {
+            record *tmp = realloc(t, 2 * cap * sizeof(record));
+            if (tmp == NULL)
+                break;
+            t = tmp;
+            cap *= 2;
+        }
+        t[*n].adlen = clamp((uint32_t)a);
+        t[*n].mlen = clamp((uint32_t)m);
+        t[*n].keyid = (uint32_t)(kid % NKEYS);
+        (*n)++;
+    }
+    fclose(f);
+    return t;
+}
+
+static void *run_worker(void *arg)
+{
+    worker *w = arg;
+    size_t i, j = 0;
+    int p;
+    uint64_t t;
+    unsigned long long clen, outlen;
+    unsigned char npub[32] = {0};
+    unsigned char *m = malloc(MAXLEN), *ad = malloc(MAXLEN);
+    unsigned char *c = malloc(MAXLEN + TAGBYTES), *d = malloc(MAXLEN);
+
+    if (m == NULL || ad == NULL || c == NULL || d == NULL) {
+        w->failed = 1;
+        goto end;
+    }
+    memset(m, 0xa5, MAXLEN);
+    memset(ad, 0x5a, MAXLEN);
+    for(p = 0; p < w->passes; p++) {
+        for(i = w->tid; i < w->ntrace; i += w->nthreads, j++) {
+            const record *r = &w->trace[i];
+            npub[0] = (unsigned char)j;     // fresh nonce for each call
+            npub[1] = (unsigned char)(j >> 8);
+            t = now_ns();
+            crypto_aead_encrypt(c, &clen, m, r->mlen, ad, r->adlen, NULL, npub,
+                keys[r->keyid]);
+            w->lat_enc[j] = now_ns() - t;
+            t = now_ns();
+            if (crypto_aead_decrypt(d, &outlen, NULL, c, clen, ad, r->adlen,
+                    npub, keys[r->keyid]) != 0)
+                w->failed = 1;
+            w->lat_dec[j] = now_ns() - t;
+            w->bytes += r->adlen + r->mlen;
+        }
+    }
+end:
+    w->ncalls = j;
+    free(m); free(ad); free(c); free(d);
+    return NULL;
+}
+
+/**
+ * Merge the per-thread latencies of one operation and print its statistics.
+ */
+static void print_op(const char *op, worker *w, int nthreads, int use_dec,
+    size_t ncalls, uint64_t bytes)
+{
+    size_t i, k = 0;
+    int tid;
+    uint64_t *all = malloc((ncalls ? ncalls : 1) * sizeof(uint64_t));
+    uint64_t sum = 0;
+    if (all == NULL)
+        return;
+    for(tid = 0; tid < nthreads; tid++)
+        for(i = 0; i < w[tid].ncalls; i++) {
+            all[k] = use_dec ? w[tid].lat_dec[i] : w[tid].lat_enc[i];
+            sum += all[k++];
+        }
+    qsort(all, k, sizeof(uint64_t), cmp_u64);
+    // throughput of a single operation: busy time spread over all threads
+    printf("  \"%s\": {\"msgs_per_s\": %.0f, \"bytes_per_s\": %.0f, "
+        "\"p50_ns\": %llu, \"p99_ns\": %llu, \"p999_ns\": %llu}", op,
+        sum ? (double)k * 1e9 * nthreads / (double)sum : 0.0,
+        sum ? (double)bytes * 1e9 * nthreads / (double)sum : 0.0,
+        k ? (unsigned long long)all[k/2] : 0,
+        k ? (unsigned long long)all[k*99/100] : 0,
+        k ? (unsigned long long)all[k*999/1000] : 0);
+    free(all);
+}
+
+int main(int argc, char *argv[])
+{
+    int opt, binary = 0, nthreads = 1, passes = 1, tid, failed = 0;
+    size_t i, ntrace = 0, ncalls = 0, gen = 0;
+    uint64_t wall, bytes = 0;
+    const char *name = "unknown";
+    record *trace;
+    worker *w;
+    pthread_t *th;
+
+    while ((opt = getopt(argc, argv, "bt:r:n:g:")) != -1) {
+        switch (opt) {
+            case 'b': binary = 1; break;
+            case 't': nthreads = atoi(optarg); break;
+            case 'r': passes = atoi(optarg); break;
+            case 'n': name = optarg; break;
+            case 'g': gen = (size_t)strtoull(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "usage: %s [-b] [-t threads] [-r passes] "
+                    "[-n name] (-g n | trace_file)\n", argv[0]);
+                return 1;
+        }
+    }
+    if (nthreads < 1 || passes < 1 || (gen == 0 && optind >= argc)) {
+        fprintf(stderr, "%s: invalid arguments\n", argv[0]);
+        return 1;
+    }
+    trace = gen ? generate_trace(gen) : load_trace(argv[optind], binary, &ntrace);
+    if (gen)
+        ntrace = gen;
+    if (trace == NULL || ntrace == 0) {
+        fprintf(stderr, "%s: cannot load trace\n", argv[0]);
+        return 1;
+    }
+    for(i = 0; i < NKEYS * 32; i++)
+        keys[i / 32][i % 32] = (unsigned char)(i * 151 + 7);
+
+    w = calloc(nthreads, sizeof(worker));
+    th = calloc(nthreads, sizeof(pthread_t));
+    for(tid = 0; tid < nthreads; tid++) {
+        size_t per_thread = (ntrace / nthreads + 1) * passes;
+        w[tid].tid = tid;
+        w[tid].nthreads = nthreads;
+        w[tid].passes = passes;
+        w[tid].trace = trace;
+        w[tid].ntrace = ntrace;
+        w[tid].lat_enc = malloc(per_thread * sizeof(uint64_t));
+        w[tid].lat_dec = malloc(per_thread * sizeof(uint64_t));
+        if (w[tid].lat_enc == NULL || w[tid].lat_dec == NULL) {
+            fprintf(stderr, "%s: out of memory\n", argv[0]);
+            return 1;
+        }
+    }
+    wall = now_ns();
+    for(tid = 0; tid < nthreads; tid++)
+        pthread_create(&th[tid], NULL, run_worker, &w[tid]);
+    for(tid = 0; tid < nthreads; tid++)
+        pthread_join(th[tid], NULL);
+    wall = now_ns() - wall;
+    for(tid = 0; tid < nthreads; tid++) {
+        ncalls += w[tid].ncalls;
+        bytes += w[tid].bytes;
+        failed |= w[tid].failed;
+    }
+
+    printf("{\"name\": \"%s\", \"threads\": %d, \"records\": %llu, "
+        "\"calls\": %llu, \"bytes\": %llu,\n", name, nthreads,
+        (unsigned long long)ntrace, (unsigned long long)ncalls,
+        (unsigned long long)bytes);
+    // overall throughput: encryption + decryption of the whole trace
+    printf("  \"wall_s\": %.6f, \"msgs_per_s\": %.0f, \"bytes_per_s\": %.0f,\n",
+        wall / 1e9, (double)ncalls * 1e9 / (double)wall,
+        (double)bytes * 1e9 / (double)wall);
+    print_op("encrypt", w, nthreads, 0, ncalls, bytes);
+    printf(",\n");
+    print_op("decrypt", w, nthreads, 1, ncalls, bytes);
+    printf("\n}\n");
+
+    for(tid = 0; tid < nthreads; tid++) {
+        free(w[tid].lat_enc);
+        free(w[tid].lat_dec);
+    }
+    free(w); free(th); free(trace);
+    if (failed)
+        fprintf(stderr, "%s: decryption failed\n", name);
+    return failed;
+}
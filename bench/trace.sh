@@ -0,0 +1,30 @@
+#!/bin/sh
+# Trace replay benchmark of one AEAD implementation directory.
+#
+# Builds 'trace.c' against the given directory (relative to the root of the
+# repository) and forwards the remaining arguments to it, e.g.
+#
+#   ./trace.sh crypto_aead/romulus-n/x86 -t 4 records.csv
+#   ./trace.sh crypto_aead/romulus-m/opt32 -g 100000
+#
+# See 'trace.c' for the trace formats. 'CC' and 'CFLAGS' can be overridden.
+
+cd "$(dirname "$0")" || exit 1
+[ $# -ge 1 ] || { echo "usage: $0 <implementation dir> [trace options]" >&2; exit 1; }
+ROOT=..
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:-"-O3"}
+dir=$1; shift
+src="$ROOT/$dir"
+case "$(uname -m)" in
+    x86_64|i?86)    ARCH_FLAGS="-mssse3";;
+    armv7*)         ARCH_FLAGS="-mfpu=neon";;
+    *)              ARCH_FLAGS="";;
+esac
+bin=$(mktemp)
+trap 'rm -f "$bin"' EXIT
+files=$(ls "$src"/*.c "$src"/*.S "$src"/*.s 2>/dev/null | grep -v '/hash\.c$')
+$CC $CFLAGS $ARCH_FLAGS -pthread -I. -I"$src" trace.c $files -o "$bin" || exit 1
+# relative trace paths are given from the caller's working directory
+cd - >/dev/null || exit 1
+"$bin" -n "$dir" "$@"
@@ -0,0 +1,43 @@
+/*******************************************************************************
+* Compile-time check of the types mirrored by 'include/skinny.h'.
+*
+* The contexts of the STREAM, bulk and sector interfaces are defined by the
+* backend headers, shared by all the backends of each interface, and copied in
+* 'skinny.h' so that the public header does not depend on the backend
+* directories. This translation unit sees both definitions (the public ones
+* being renamed while 'skinny.h' is included) and fails to compile if their
+* size or the offset/size of any field differ. It does not define anything.
+*******************************************************************************/
+#include <stddef.h>
+#include "romulus_stream.h"
+#include "skinny128_bulk.h"
+#include "skinny_sector.h"
+
+#define romulusn_stream		skinny_abi_romulusn_stream
+#define skinny128_384_key	skinny_abi_skinny128_384_key
+#define skinny_sector_key	skinny_abi_skinny_sector_key
+#include "skinny.h"
+#undef romulusn_stream
+#undef skinny128_384_key
+#undef skinny_sector_key
+
+#define SKINNY_ABI_SIZE(type)												\
+	_Static_assert(sizeof(type) == sizeof(skinny_abi_##type),				\
+		"size of '" #type "' differs in skinny.h")
+#define SKINNY_ABI_FIELD(type, field)										\
+	_Static_assert(offsetof(type, field) ==									\
+		offsetof(skinny_abi_##type, field) &&								\
+		sizeof(((type *)0)->field) == sizeof(((skinny_abi_##type *)0)->field),\
+		"layout of '" #type "." #field "' differs in skinny.h")
+
+SKINNY_ABI_SIZE(romulusn_stream);
+SKINNY_ABI_FIELD(romulusn_stream, k);
+SKINNY_ABI_FIELD(romulusn_stream, prefix);
+SKINNY_ABI_FIELD(romulusn_stream, status);
+SKINNY_ABI_FIELD(romulusn_stream, index);
+
+SKINNY_ABI_SIZE(skinny128_384_key);
+SKINNY_ABI_FIELD(skinny128_384_key, rtk_23);
+
+SKINNY_ABI_SIZE(skinny_sector_key);
+SKINNY_ABI_FIELD(skinny_sector_key, rtk_2);
@@ -0,0 +1,164 @@
+/*******************************************************************************
+* Symbol namespacing used to link several backends into a single 'libskinny'.
+*
+* Force-included (through '-include') in every source file of a backend, with
+* SKINNY_NS_PREFIX set to '<variant>_<backend>_' (e.g. 'romulusn_x86_'). All
+* the external symbols defined by the backends are renamed accordingly, e.g.
+* 'crypto_aead_encrypt' becomes 'romulusn_x86_encrypt' and 'skinny128_384_plus'
+* becomes 'romulusn_x86_skinny128_384_plus'. Since the file is also processed
+* for '.S' sources, it must only contain preprocessor directives.
+*
+* Any new external symbol introduced in a backend must be added here, otherwise
+* linking 'libskinny' as a shared library fails with multiple definitions.
+*******************************************************************************/
+#ifndef SKINNY_NAMESPACE_H_
+#define SKINNY_NAMESPACE_H_
+
+#define SKINNY_NS_CAT_(a, b)	a##b
+#define SKINNY_NS_CAT(a, b)		SKINNY_NS_CAT_(a, b)
+#define SKINNY_NS(x)			SKINNY_NS_CAT(SKINNY_NS_PREFIX, x)
+
+// SUPERCOP, detached-tag, iovec, STREAM, bulk Skinny and sector entry points
+#define crypto_aead_encrypt		SKINNY_NS(encrypt)
+#define crypto_aead_decrypt		SKINNY_NS(decrypt)
+#define crypto_hash				SKINNY_NS(hash)
+#define romulusn_encrypt_detached	SKINNY_NS(encrypt_detached)
+#define romulusn_decrypt_detached	SKINNY_NS(decrypt_detached)
+#define romulusm_encrypt_detached	SKINNY_NS(encrypt_detached)
+#define romulusm_decrypt_detached	SKINNY_NS(decrypt_detached)
+#define romulust_encrypt_detached	SKINNY_NS(encrypt_detached)
+#define romulust_decrypt_detached	SKINNY_NS(decrypt_detached)
+#define romulusn_encrypt_iov	SKINNY_NS(encrypt_iov)
+#define romulusn_decrypt_iov	SKINNY_NS(decrypt_iov)
+#define romulusn_stream_init	SKINNY_NS(stream_init)
+#define romulusn_stream_seal_segment	SKINNY_NS(stream_seal_segment)
+#define romulusn_stream_open_segment	SKINNY_NS(stream_open_segment)
+#define romulusn_stream_seal_segment_at	SKINNY_NS(stream_seal_segment_at)
+#define romulusn_stream_open_segment_at	SKINNY_NS(stream_open_segment_at)
+#define skinny128_384_key_setup	SKINNY_NS(key_setup)
+#define skinny128_384_encrypt_many	SKINNY_NS(encrypt_many)
+#define skinny128_384_decrypt_many	SKINNY_NS(decrypt_many)
+#define skinny_sector_key_setup	SKINNY_NS(key_setup)
+#define skinny_sector_encrypt	SKINNY_NS(encrypt)
+#define skinny_sector_decrypt	SKINNY_NS(decrypt)
+#define skinny_sector_encrypt_at	SKINNY_NS(encrypt_at)
+#define skinny_sector_decrypt_at	SKINNY_NS(decrypt_at)
+#define skinny_sector_encrypt_mt	SKINNY_NS(encrypt_mt)
+#define skinny_sector_decrypt_mt	SKINNY_NS(decrypt_mt)
+
+// Romulus mode glue
+#define romulusn_init			SKINNY_NS(romulusn_init)
+#define romulusn_process_ad		SKINNY_NS(romulusn_process_ad)
+#define romulusn_process_msg	SKINNY_NS(romulusn_process_msg)
+#define romulusn_generate_tag	SKINNY_NS(romulusn_generate_tag)
+#define romulusn_verify_tag		SKINNY_NS(romulusn_verify_tag)
+#define romulusm_init			SKINNY_NS(romulusm_init)
+#define romulusm_process_ad		SKINNY_NS(romulusm_process_ad)
+#define romulusm_process_ad_msg_dec	SKINNY_NS(romulusm_process_ad_msg_dec)
+#define romulusm_process_msg	SKINNY_NS(romulusm_process_msg)
+#define romulusm_generate_tag	SKINNY_NS(romulusm_generate_tag)
+#define romulusm_verify_tag		SKINNY_NS(romulusm_verify_tag)
+#define romulust_init			SKINNY_NS(romulust_init)
+#define romulust_kdf			SKINNY_NS(romulust_kdf)
+#define romulust_process_msg	SKINNY_NS(romulust_process_msg)
+#define romulust_generate_tag	SKINNY_NS(romulust_generate_tag)
+#define romulusht				SKINNY_NS(romulusht)
+#define hirose_128_128_256		SKINNY_NS(hirose_128_128_256)
+#define ipad_128				SKINNY_NS(ipad_128)
+#define ipad_256				SKINNY_NS(ipad_256)
+#define initialize				SKINNY_NS(initialize)
+#define pad						SKINNY_NS(pad)
+#define copy					SKINNY_NS(copy)
+#define zeroize					SKINNY_NS(zeroize)
+
+// Skinny-128-384(+) kernels
+#define skinny128_384_plus		SKINNY_NS(skinny128_384_plus)
+#define skinny128_384_plus_x2	SKINNY_NS(skinny128_384_plus_x2)
+#define skinny128_384_plus_x3	SKINNY_NS(skinny128_384_plus_x3)
+#define skinny128_384_plus_rho	SKINNY_NS(skinny128_384_plus_rho)
+#define skinny128_384_plus_notk2	SKINNY_NS(skinny128_384_plus_notk2)
+#define skinny128_384_plus_encrypt	SKINNY_NS(skinny128_384_plus_encrypt)
+#define skinny128_384_plus_decrypt	SKINNY_NS(skinny128_384_plus_decrypt)
+#define skinny128_384_plus_inv	SKINNY_NS(skinny128_384_plus_inv)
+#define skinny128_384			SKINNY_NS(skinny128_384)
+#define skinny128_384_x2		SKINNY_NS(skinny128_384_x2)
+#define skinny128_384_x3		SKINNY_NS(skinny128_384_x3)
+#define skinny128_384_inv_x2	SKINNY_NS(skinny128_384_inv_x2)
+#define skinny128_384_inv		SKINNY_NS(skinny128_384_inv)
+#define skinny128_384_encrypt	SKINNY_NS(skinny128_384_encrypt)
+#define skinny128_384_decrypt	SKINNY_NS(skinny128_384_decrypt)
+#define mixcolumns_0			SKINNY_NS(mixcolumns_0)
+#define mixcolumns_1			SKINNY_NS(mixcolumns_1)
+#define mixcolumns_2			SKINNY_NS(mixcolumns_2)
+#define mixcolumns_3			SKINNY_NS(mixcolumns_3)
+#define inv_mixcolumns_0		SKINNY_NS(inv_mixcolumns_0)
+#define inv_mixcolumns_1		SKINNY_NS(inv_mixcolumns_1)
+#define inv_mixcolumns_2		SKINNY_NS(inv_mixcolumns_2)
+#define inv_mixcolumns_3		SKINNY_NS(inv_mixcolumns_3)
+
+// Skinny-128-128/256 kernels
+#define skinny128_128			SKINNY_NS(skinny128_128)
+#define skinny128_128_otf		SKINNY_NS(skinny128_128_otf)
+#define skinny128_128_x2		SKINNY_NS(skinny128_128_x2)
+#define skinny128_256			SKINNY_NS(skinny128_256)
+#define skinny128_256_otf		SKINNY_NS(skinny128_256_otf)
+#define skinny128_256_x2		SKINNY_NS(skinny128_256_x2)
+#define skinny128_256_x3		SKINNY_NS(skinny128_256_x3)
+#define skinny128_256_inv		SKINNY_NS(skinny128_256_inv)
+#define skinny128_256_inv_x2	SKINNY_NS(skinny128_256_inv_x2)
+
+// Fixsliced 2-block AVX2 kernels
+#define core_skinny128_enc_x2	SKINNY_NS(core_skinny128_enc_x2)
+#define core_skinny128_dec_x2	SKINNY_NS(core_skinny128_dec_x2)
+#define skinny128_128_enc_x2	SKINNY_NS(skinny128_128_enc_x2)
+#define skinny128_128_dec_x2	SKINNY_NS(skinny128_128_dec_x2)
+#define skinny128_256_enc_x2	SKINNY_NS(skinny128_256_enc_x2)
+#define skinny128_256_dec_x2	SKINNY_NS(skinny128_256_dec_x2)
+#define skinny128_384_enc_x2	SKINNY_NS(skinny128_384_enc_x2)
+#define skinny128_384_dec_x2	SKINNY_NS(skinny128_384_dec_x2)
+#define skinny128_384_plus_enc_x2	SKINNY_NS(skinny128_384_plus_enc_x2)
+#define skinny128_384_plus_dec_x2	SKINNY_NS(skinny128_384_plus_dec_x2)
+
+// Fixsliced 2-block opt32 kernels
+#define skinny128_128_encrypt	SKINNY_NS(skinny128_128_encrypt)
+#define skinny128_128_decrypt	SKINNY_NS(skinny128_128_decrypt)
+#define skinny128_256_encrypt	SKINNY_NS(skinny128_256_encrypt)
+#define skinny128_256_decrypt	SKINNY_NS(skinny128_256_decrypt)
+#define skinny128_encrypt_rtk	SKINNY_NS(skinny128_encrypt_rtk)
+#define skinny128_decrypt_rtk	SKINNY_NS(skinny128_decrypt_rtk)
+
+// Tweakey schedule
+#define rconst_32_bs			SKINNY_NS(rconst_32_bs)
+#define packing					SKINNY_NS(packing)
+#define unpacking				SKINNY_NS(unpacking)
+#define lfsr2_bs				SKINNY_NS(lfsr2_bs)
+#define lfsr3_bs				SKINNY_NS(lfsr3_bs)
+#define add_tweakey				SKINNY_NS(add_tweakey)
+#define permute_tk				SKINNY_NS(permute_tk)
+#define permute_tk_2			SKINNY_NS(permute_tk_2)
+#define permute_tk_4			SKINNY_NS(permute_tk_4)
+#define permute_tk_6			SKINNY_NS(permute_tk_6)
+#define permute_tk_8			SKINNY_NS(permute_tk_8)
+#define permute_tk_10			SKINNY_NS(permute_tk_10)
+#define permute_tk_12			SKINNY_NS(permute_tk_12)
+#define permute_tk_14			SKINNY_NS(permute_tk_14)
+#define permute_tk_8rounds		SKINNY_NS(permute_tk_8rounds)
+#define precompute_tk			SKINNY_NS(precompute_tk)
+#define precompute_lfsr_tk2		SKINNY_NS(precompute_lfsr_tk2)
+#define precompute_lfsr_tk3		SKINNY_NS(precompute_lfsr_tk3)
+#define precompute_lfsr_tk2_3	SKINNY_NS(precompute_lfsr_tk2_3)
+#define precompute_rtk1			SKINNY_NS(precompute_rtk1)
+#define precompute_rtk2_3		SKINNY_NS(precompute_rtk2_3)
+#define precompute_rtk			SKINNY_NS(precompute_rtk)
+#define precompute_rtk_plus		SKINNY_NS(precompute_rtk_plus)
+#define tk_schedule_1			SKINNY_NS(tk_schedule_1)
+#define tk_schedule_2			SKINNY_NS(tk_schedule_2)
+#define tk_schedule_3			SKINNY_NS(tk_schedule_3)
+#define tk_schedule_13			SKINNY_NS(tk_schedule_13)
+#define tk_schedule_23			SKINNY_NS(tk_schedule_23)
+#define tk_schedule_123			SKINNY_NS(tk_schedule_123)
+#define tk_schedule_384			SKINNY_NS(tk_schedule_384)
+#define tk_update_1				SKINNY_NS(tk_update_1)
+#define tk_domain_1				SKINNY_NS(tk_domain_1)
+
+#endif  // SKINNY_NAMESPACE_H_
@@ -10,7 +10,24 @@
 #include "crypto_aead.h"
 
 
-//Encryption and authentication using Romulus-M
+//Encryption and authentication using Romulus-M with a detached tag ('c' may be 'm')
+int romulusm_encrypt_detached
+    (unsigned char *c, unsigned char *tag,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    uint8_t state[BLOCKBYTES];
+    uint8_t tk1[TWEAKEYBYTES];
+    romulusm_init(state, tk1);
+    romulusm_process_ad(state, ad, adlen, m, mlen, tk1, npub, k);
+    romulusm_generate_tag(tag, state);
+    romulusm_process_msg(c, m, mlen, state, tk1, npub, k, ENCRYPT_MODE);
+    return 0;
+}
+
+//Encryption and authentication using Romulus-M following the SUPERCOP API
 int crypto_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
@@ -20,17 +37,35 @@ int crypto_aead_encrypt
      const unsigned char *k)
 {
     (void)nsec;
-    uint8_t state[BLOCKBYTES];
-    uint8_t tk1[TWEAKEYBYTES];
     *clen = mlen + TAGBYTES;
+    return romulusm_encrypt_detached(c, c + mlen, m, mlen, ad, adlen, npub, k);
+}
+
+//Decryption and tag verification using Romulus-M with a detached tag ('m' may be 'c')
+int romulusm_decrypt_detached
+    (unsigned char *m,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *tag,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    uint8_t tk1[TWEAKEYBYTES];
+    uint8_t state[BLOCKBYTES];
     romulusm_init(state, tk1);
-    romulusm_process_ad(state, ad, adlen, m, mlen, tk1, npub, k);
-    romulusm_generate_tag(c + mlen, state);
-    romulusm_process_msg(c, m, mlen, state, tk1, npub, k, ENCRYPT_MODE);
+    for(int i = 0; i < TAGBYTES; i++)   // keystream initialized with the tag
+        state[i] = tag[i];
+    romulusm_process_msg(m, c, clen, state, tk1, npub, k, DECRYPT_MODE);
+    romulusm_init(state, tk1);  
+    romulusm_process_ad(state, ad, adlen, m, clen, tk1, npub, k);
+    if (romulusm_verify_tag(tag, state)) {  // unverified plaintext is never released
+        zeroize(m, clen);
+        return -1;
+    }
     return 0;
 }
 
-//Decryption and tag verification using Romulus-M
+//Decryption and tag verification using Romulus-M following the SUPERCOP API
 int crypto_aead_decrypt
     (unsigned char *m, unsigned long long *mlen,
      unsigned char *nsec,
@@ -40,17 +75,8 @@ int crypto_aead_decrypt
      const unsigned char *k)
 {
     (void)nsec;
-    uint8_t tk1[TWEAKEYBYTES];
-    uint8_t state[BLOCKBYTES];
-
     if (clen < TAGBYTES)
         return -1;
-
-    clen -= TAGBYTES;
-    *mlen = clen;
-    romulusm_init(state, tk1);
-    romulusm_process_msg(m, c, clen, state, tk1, npub, k, DECRYPT_MODE);
-    romulusm_init(state, tk1);  
-    romulusm_process_ad(state, ad, adlen, m, clen, tk1, npub, k);
-    return romulusm_verify_tag(c + *mlen, state);
+    *mlen = clen - TAGBYTES;
+    return romulusm_decrypt_detached(m, c, *mlen, c + *mlen, ad, adlen, npub, k);
 }
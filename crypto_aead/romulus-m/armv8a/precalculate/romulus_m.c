@@ -22,9 +22,9 @@ static void copy(uint8_t dest[], const uint8_t src[], int srclen)
 /**
  * Equivalent to 'memset(buf, 0x00, buflen)'.
  */
-void zeroize(uint8_t buf[], int buflen)
+void zeroize(uint8_t buf[], unsigned long long buflen)
 {
-  int i;
+  unsigned long long i;
   for(i = 0; i < buflen; i++)
     buf[i] = 0x00;
 }
@@ -183,6 +183,7 @@ void romulusm_process_ad(
 /**
  * Process the message and updates the internal state as well as the output
  * buffer accordingly.
+ * In DECRYPT_MODE, 'state' is expected to hold the tag.
  */
 void romulusm_process_msg(
     uint8_t *out, const uint8_t *in, unsigned long long inlen,
@@ -195,8 +196,6 @@ void romulusm_process_msg(
         tk1[0] = 0x01;
         zeroize(tk1+1, TWEAKEYBYTES-1);
     }
-    else    // if DECRYPT_MODE init state with tag
-        copy(state, in + inlen, TAGBYTES);
         
     if (inlen > 0) {
         SET_DOMAIN(tk1, 0x24);
@@ -47,8 +47,8 @@
 //use pad as a tmp variable in case y = z
 #define RHO(x,y,z,tmp) ({       \
     G(tmp,x);                   \
-    XOR_BLOCK(y, tmp, z);       \
     XOR_BLOCK(x, x, z);         \
+    XOR_BLOCK(y, tmp, z);       \
 })
 
 //Rho inverse as defined in the Romulus specification
@@ -59,7 +59,7 @@
     XOR_BLOCK(x, x, z);             \
 })
 
-void zeroize(uint8_t buf[], int buflen);
+void zeroize(uint8_t buf[], unsigned long long buflen);
 
 // Romulus-M core functions defined in 'romulus_m.c'
 void romulusm_init(uint8_t *state, uint8_t *tk1);
@@ -81,4 +81,23 @@ void romulusm_generate_tag(uint8_t *c, uint8_t *state);
 
 uint32_t romulusm_verify_tag(const uint8_t *tag, uint8_t *state);
 
+// Detached-tag interface: the tag is written to/read from its own buffer and
+// the output buffer may be the input one (in-place operation).
+// If the tag verification fails, decryption returns -1 and zeroizes the 'clen'
+// bytes of 'm', so that no unverified plaintext is released (in place, the
+// ciphertext is lost as well).
+// 'crypto_aead_encrypt' and 'crypto_aead_decrypt' are wrappers around them.
+int romulusm_encrypt_detached(
+    unsigned char *c, unsigned char *tag,
+    const unsigned char *m, unsigned long long mlen,
+    const unsigned char *ad, unsigned long long adlen,
+    const unsigned char *npub, const unsigned char *k);
+
+int romulusm_decrypt_detached(
+    unsigned char *m,
+    const unsigned char *c, unsigned long long clen,
+    const unsigned char *tag,
+    const unsigned char *ad, unsigned long long adlen,
+    const unsigned char *npub, const unsigned char *k);
+
 #endif  // ROMULUS_H_
@@ -9,9 +9,37 @@
 #include "romulus_m.h"
 #include "tk_schedule.h"
 #include "crypto_aead.h"
+#include "skinny_stats.h"
 
 
-//Encryption and authentication using Romulus-M
+//Encryption and authentication using Romulus-M with a detached tag ('c' may be 'm')
+int romulusm_encrypt_detached
+    (unsigned char *c, unsigned char *tag,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_ENCRYPT, 1);
+    uint8_t state[BLOCKBYTES];
+    uint8_t tk1[TWEAKEYBYTES];
+    uint32_t rtk_23[RTK23_WORDS];
+    uint32_t fault;
+    romulusm_init(state, tk1);
+    fault = romulusm_process_ad(state, ad, adlen, m, mlen, rtk_23, tk1, npub, k);
+    romulusm_generate_tag(tag, state);
+    fault |= romulusm_process_msg(c, m, mlen, state, rtk_23, tk1, ENCRYPT_MODE);
+    zeroize((uint8_t *)rtk_23, sizeof(rtk_23));
+    SKINNY_STATS_END(SKINNY_STATS_ENCRYPT);
+    if (fault) {    // fail closed: nothing is released
+        zeroize(c, mlen);
+        zeroize(tag, TAGBYTES);
+        return -1;
+    }
+    return 0;
+}
+
+//Encryption and authentication using Romulus-M following the SUPERCOP API
 int crypto_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
@@ -21,19 +49,45 @@ int crypto_aead_encrypt
      const unsigned char *k)
 {
     (void)nsec;
-    uint8_t state[BLOCKBYTES];
-    uint8_t tk1[TWEAKEYBYTES];
-    uint32_t rtk_23[BLOCKBYTES*SKINNY128_384_ROUNDS/4];
     *clen = mlen + TAGBYTES;
+    return romulusm_encrypt_detached(c, c + mlen, m, mlen, ad, adlen, npub, k);
+}
+
+//Decryption and tag verification using Romulus-M with a detached tag ('m' may be 'c')
+int romulusm_decrypt_detached
+    (unsigned char *m,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *tag,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_DECRYPT, 1);
+    uint8_t tk1[TWEAKEYBYTES];
+    uint8_t state[BLOCKBYTES];
+    uint32_t rtk_23[RTK23_WORDS];
+    uint32_t fault;
     romulusm_init(state, tk1);
-    romulusm_process_ad(state, ad, adlen, m, mlen, rtk_23, tk1, npub, k);
-    romulusm_generate_tag(c + mlen, state);
-    romulusm_process_msg(c, m, mlen, state, rtk_23, tk1, ENCRYPT_MODE);
+    for(int i = 0; i < TAGBYTES; i++)   // keystream initialized with the tag
+        state[i] = tag[i];
+    tk_schedule_23(rtk_23, npub, k);
+    fault = romulusm_process_msg(m, c, clen, state, rtk_23, tk1, DECRYPT_MODE);
+    romulusm_init(state, tk1);  
+    fault |= romulusm_process_ad(state, ad, adlen, m, clen, rtk_23, tk1, npub, k);
     zeroize((uint8_t *)rtk_23, sizeof(rtk_23));
+    SKINNY_STATS_END(SKINNY_STATS_DECRYPT);
+    if (fault) {    // fail closed: nothing is released
+        zeroize(m, clen);
+        return -1;
+    }
+    if (romulusm_verify_tag(tag, state)) {  // unverified plaintext is never released
+        zeroize(m, clen);
+        return -1;
+    }
     return 0;
 }
 
-//Decryption and tag verification using Romulus-M
+//Decryption and tag verification using Romulus-M following the SUPERCOP API
 int crypto_aead_decrypt
     (unsigned char *m, unsigned long long *mlen,
      unsigned char *nsec,
@@ -43,20 +97,8 @@ int crypto_aead_decrypt
      const unsigned char *k)
 {
     (void)nsec;
-    uint8_t tk1[TWEAKEYBYTES];
-    uint8_t state[BLOCKBYTES];
-    uint32_t rtk_23[BLOCKBYTES*SKINNY128_384_ROUNDS/4];
-
     if (clen < TAGBYTES)
         return -1;
-
-    clen -= TAGBYTES;
-    *mlen = clen;
-    romulusm_init(state, tk1);
-    tk_schedule_23(rtk_23, npub, k);
-    romulusm_process_msg(m, c, clen, state, rtk_23, tk1, DECRYPT_MODE);
-    romulusm_init(state, tk1);  
-    romulusm_process_ad(state, ad, adlen, m, clen, rtk_23, tk1, npub, k);
-    zeroize((uint8_t *)rtk_23, sizeof(rtk_23));
-    return romulusm_verify_tag(c + *mlen, state);
+    *mlen = clen - TAGBYTES;
+    return romulusm_decrypt_detached(m, c, *mlen, c + *mlen, ad, adlen, npub, k);
 }
@@ -12,9 +12,9 @@
 /**
  * Equivalent to 'memset(buf, 0x00, buflen)'.
  */
-void zeroize(uint8_t buf[], int buflen)
+void zeroize(uint8_t buf[], unsigned long long buflen)
 {
-  int i;
+  unsigned long long i;
   for(i = 0; i < buflen; i++)
     buf[i] = 0x00;
 }
@@ -77,14 +77,17 @@ void romulusm_init(uint8_t *state, uint8_t *tk1)
 
 /**
  * Process the additional data and updates the internal state accordingly.
+ * Returns a non-zero value if a fault has been detected (only relevant for
+ * the redundant implementation).
  */
-void romulusm_process_ad(
+uint32_t romulusm_process_ad(
     uint8_t *state, const uint8_t *ad, unsigned long long adlen,
     const unsigned char *m, unsigned long long mlen, uint32_t *rtk_23,
     uint8_t *tk1, const uint8_t *npub, const uint8_t *k)
 {
+    uint32_t fault = 0;
     uint32_t tmp;
-    uint32_t rtk_1[TKPERMORDER*BLOCKBYTES/4];
+    uint32_t rtk_1[RTK1_WORDS];
     uint8_t pad[BLOCKBYTES];
     uint8_t final_domain = 0x30 ^ final_ad_domain(adlen, mlen);
     
@@ -93,7 +96,7 @@ void romulusm_process_ad(
         UPDATE_CTR(tk1);
         XOR_BLOCK(state, state, ad);
         tk_schedule_123(rtk_1, rtk_23, tk1, ad+BLOCKBYTES, k);
-        skinny128_384_plus(state, state, rtk_1, rtk_23);
+        SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
         UPDATE_CTR(tk1);
         ad += 2*BLOCKBYTES;
         adlen -= 2*BLOCKBYTES;
@@ -103,7 +106,7 @@ void romulusm_process_ad(
         UPDATE_CTR(tk1);
         XOR_BLOCK(state, state, ad);
         tk_schedule_123(rtk_1, rtk_23, tk1, ad+BLOCKBYTES, k);
-        skinny128_384_plus(state, state, rtk_1, rtk_23);
+        SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
         UPDATE_CTR(tk1);
     } else if (adlen > BLOCKBYTES) {        // Left-over partial double block
         adlen -= BLOCKBYTES;
@@ -113,7 +116,7 @@ void romulusm_process_ad(
         zeroize(pad + adlen, 15 - adlen);
         pad[15] = adlen;                    // Padding
         tk_schedule_123(rtk_1, rtk_23, tk1, pad, k);
-        skinny128_384_plus(state, state, rtk_1, rtk_23);
+        SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
         UPDATE_CTR(tk1);
     } else {
         SET_DOMAIN(tk1, 0x2C);
@@ -127,7 +130,7 @@ void romulusm_process_ad(
         }
         if (mlen >= BLOCKBYTES) {
             tk_schedule_123(rtk_1, rtk_23, tk1, m, k);
-            skinny128_384_plus(state, state, rtk_1, rtk_23);
+            SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
             if (mlen > BLOCKBYTES)
                 UPDATE_CTR(tk1);
             mlen -= BLOCKBYTES;
@@ -137,7 +140,7 @@ void romulusm_process_ad(
             zeroize(pad + mlen, BLOCKBYTES - mlen - 1);
             pad[15] = (uint8_t)mlen;             // Padding
             tk_schedule_123(rtk_1, rtk_23, tk1, pad, k);
-            skinny128_384_plus(state, state, rtk_1, rtk_23);
+            SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
             mlen = 0;
         }
     }
@@ -147,7 +150,7 @@ void romulusm_process_ad(
         UPDATE_CTR(tk1);
         XOR_BLOCK(state, state, m);
         tk_schedule_123(rtk_1, rtk_23, tk1, m+BLOCKBYTES, k);
-        skinny128_384_plus(state, state, rtk_1, rtk_23);
+        SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
         UPDATE_CTR(tk1);
         m += 2 * BLOCKBYTES;
         mlen -= 2 * BLOCKBYTES;
@@ -157,7 +160,7 @@ void romulusm_process_ad(
         UPDATE_CTR(tk1);
         XOR_BLOCK(state, state, m);
         tk_schedule_123(rtk_1, rtk_23, tk1, m+BLOCKBYTES, k);
-        skinny128_384_plus(state, state, rtk_1, rtk_23);
+        SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
     } else if (mlen > BLOCKBYTES) {         // Last message double block is partial
         mlen -= BLOCKBYTES;
         UPDATE_CTR(tk1);
@@ -166,7 +169,7 @@ void romulusm_process_ad(
         zeroize(pad + mlen, BLOCKBYTES - mlen - 1);
         pad[15] = (uint8_t)mlen;                 // Padding
         tk_schedule_123(rtk_1, rtk_23, tk1, pad, k);
-        skinny128_384_plus(state, state, rtk_1, rtk_23);
+        SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
     } else if (mlen == BLOCKBYTES) {        // Last message single block is full
         XOR_BLOCK(state, state, m);
     } else if (mlen > 0) {                  // Last message single block is partial
@@ -178,44 +181,47 @@ void romulusm_process_ad(
     SET_DOMAIN(tk1, final_domain);
     UPDATE_CTR(tk1);
     tk_schedule_123(rtk_1, rtk_23, tk1, npub, k);
-    skinny128_384_plus(state, state, rtk_1, rtk_23);
+    SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
+    return fault;
 }
 
 /**
  * Process the message and updates the internal state as well as the output
  * buffer accordingly.
+ * Returns a non-zero value if a fault has been detected (only relevant for
+ * the redundant implementation).
+ * In DECRYPT_MODE, 'state' is expected to hold the tag.
  */
-void romulusm_process_msg(
+uint32_t romulusm_process_msg(
     uint8_t *out, const uint8_t *in, unsigned long long inlen,
     uint8_t *state, const uint32_t *rtk_23, uint8_t *tk1, const int mode)
 {
+    uint32_t fault = 0;
     uint32_t tmp;
     uint8_t tmp_blk[BLOCKBYTES];
-    uint32_t rtk_1[TKPERMORDER*BLOCKBYTES/4];
+    uint32_t rtk_1[RTK1_WORDS];
     
     if (mode == ENCRYPT_MODE) {
         tk1[0] = 0x01;
         zeroize(tk1+1, TWEAKEYBYTES-1);
     }
-    else    // if DECRYPT_MODE init state with tag
-        copy(state, in + inlen, TAGBYTES);
         
     if (inlen > 0) {
         SET_DOMAIN(tk1, 0x24);
+        tk_schedule_1(rtk_1, tk1);
         while (inlen > BLOCKBYTES) {
-            tk_schedule_1(rtk_1, tk1);
-            skinny128_384_plus(state, state, rtk_1, rtk_23);
+            SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
             if (mode == ENCRYPT_MODE)
                 RHO(state, out, in, tmp_blk);
             else
                 RHO_INV(state, in, out, tmp_blk);
             UPDATE_CTR(tk1);
+            tk_update_1(rtk_1);     // no need to recompute the entire schedule
             out += BLOCKBYTES;
             in += BLOCKBYTES;
             inlen -= BLOCKBYTES;
         }
-        tk_schedule_1(rtk_1, tk1);
-        skinny128_384_plus(state, state, rtk_1, rtk_23);
+        SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
         for(int i = 0; i < (int)inlen; i++) {
             tmp = in[i];                     // Use of tmp variable in case c = m
             out[i] = in[i] ^ (state[i] >> 1) ^ (state[i] & 0x80) ^ (state[i] << 7);
@@ -223,6 +229,7 @@ void romulusm_process_msg(
         }
         state[15] ^= (uint8_t)inlen;              // Padding
     }
+    return fault;
 }
 
 /**
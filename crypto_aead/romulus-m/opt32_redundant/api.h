@@ -0,0 +1 @@
+../opt32/api.h
\ No newline at end of file
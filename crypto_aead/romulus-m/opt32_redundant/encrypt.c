@@ -0,0 +1 @@
+../opt32/encrypt.c
\ No newline at end of file
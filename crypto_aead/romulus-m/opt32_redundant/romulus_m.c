@@ -0,0 +1 @@
+../opt32/romulus_m.c
\ No newline at end of file
@@ -0,0 +1 @@
+../opt32/romulus_m.h
\ No newline at end of file
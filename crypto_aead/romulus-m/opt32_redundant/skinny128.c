@@ -0,0 +1 @@
+../../romulus-n/opt32_redundant/skinny128.c
\ No newline at end of file
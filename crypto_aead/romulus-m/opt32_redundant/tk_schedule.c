@@ -0,0 +1 @@
+../../romulus-n/opt32_redundant/tk_schedule.c
\ No newline at end of file
@@ -1 +0,0 @@
-../armv8a/precalculate/encrypt.c
\ No newline at end of file
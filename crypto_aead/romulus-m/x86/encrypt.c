@@ -0,0 +1,93 @@
+/**
+ * Romulus-M implementation following the SUPERCOP API.
+ * 
+ * @author      Alexandre Adomnicai
+ *              alex.adomnicai@gmail.com
+ * 
+ * @date        March 2022
+ */
+#include "romulus_m.h"
+#include "crypto_aead.h"
+#include "skinny_stats.h"
+
+
+//Encryption and authentication using Romulus-M with a detached tag ('c' may be 'm')
+int romulusm_encrypt_detached
+    (unsigned char *c, unsigned char *tag,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_ENCRYPT, 1);
+    uint8_t state[BLOCKBYTES];
+    uint8_t tk1[TWEAKEYBYTES];
+    uint8_t rtk_23[SKINNY128_384_ROUNDS*BLOCKBYTES/2];
+    romulusm_init(state, tk1);
+    romulusm_process_ad(state, ad, adlen, m, mlen, rtk_23, tk1, npub, k);
+    romulusm_generate_tag(tag, state);
+    romulusm_process_msg(c, m, mlen, state, rtk_23, tk1, ENCRYPT_MODE);
+    zeroize(rtk_23, SKINNY128_384_ROUNDS*BLOCKBYTES/2);
+    SKINNY_STATS_END(SKINNY_STATS_ENCRYPT);
+    return 0;
+}
+
+//Encryption and authentication using Romulus-M following the SUPERCOP API
+int crypto_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    (void)nsec;
+    *clen = mlen + TAGBYTES;
+    return romulusm_encrypt_detached(c, c + mlen, m, mlen, ad, adlen, npub, k);
+}
+
+//Decryption and tag verification using Romulus-M with a detached tag ('m' may be 'c')
+int romulusm_decrypt_detached
+    (unsigned char *m,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *tag,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_DECRYPT, 1);
+    uint32_t fail;
+    uint8_t tk1[TWEAKEYBYTES];
+    uint8_t state[BLOCKBYTES];
+    uint8_t rtk_23[SKINNY128_384_ROUNDS*BLOCKBYTES/2];
+    uint8_t rtk_23_mac[SKINNY128_384_ROUNDS*BLOCKBYTES/2];
+    romulusm_init(state, tk1);
+    tk_schedule_23(rtk_23, npub, k);
+    romulusm_process_ad_msg_dec(state, ad, adlen, m, c, clen, tag, rtk_23,
+        rtk_23_mac, tk1, npub, k);
+    zeroize(rtk_23, SKINNY128_384_ROUNDS*BLOCKBYTES/2);
+    zeroize(rtk_23_mac, SKINNY128_384_ROUNDS*BLOCKBYTES/2);
+    fail = romulusm_verify_tag(tag, state);
+    if (fail) {     // unverified plaintext is never released
+        zeroize(m, clen);
+        return -1;
+    }
+    SKINNY_STATS_END(SKINNY_STATS_DECRYPT);
+    return 0;
+}
+
+//Decryption and tag verification using Romulus-M following the SUPERCOP API
+int crypto_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    (void)nsec;
+    if (clen < TAGBYTES)
+        return -1;
+    *mlen = clen - TAGBYTES;
+    return romulusm_decrypt_detached(m, c, *mlen, c + *mlen, ad, adlen, npub, k);
+}
@@ -1 +0,0 @@
-../armv8a/precalculate/romulus_m.c
\ No newline at end of file
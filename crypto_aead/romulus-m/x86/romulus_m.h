@@ -1 +0,0 @@
-../armv8a/precalculate/romulus_m.h
\ No newline at end of file
@@ -0,0 +1,121 @@
+#ifndef ROMULUS_H_
+#define ROMULUS_H_
+
+#include "skinny128.h"
+
+#define TAGBYTES    16
+#define KEYBYTES    TWEAKEYBYTES
+
+#define ENCRYPT_MODE 0
+#define DECRYPT_MODE 1
+
+#define SET_DOMAIN(tk1, domain) (tk1[7] = (domain))
+
+//G as defined in the Romulus specification in a 32-bit word-wise manner
+#define G(x,y) ({                                                                       \
+    tmp = ((uint32_t*)(y))[0];                                                          \
+    ((uint32_t*)(x))[0] = (tmp >> 1 & 0x7f7f7f7f) ^ ((tmp ^ (tmp << 7)) & 0x80808080);  \
+    tmp = ((uint32_t*)(y))[1];                                                          \
+    ((uint32_t*)(x))[1] = (tmp >> 1 & 0x7f7f7f7f) ^ ((tmp ^ (tmp << 7)) & 0x80808080);  \
+    tmp = ((uint32_t*)(y))[2];                                                          \
+    ((uint32_t*)(x))[2] = (tmp >> 1 & 0x7f7f7f7f) ^ ((tmp ^ (tmp << 7)) & 0x80808080);  \
+    tmp = ((uint32_t*)(y))[3];                                                          \
+    ((uint32_t*)(x))[3] = (tmp >> 1 & 0x7f7f7f7f) ^ ((tmp ^ (tmp << 7)) & 0x80808080);  \
+})
+
+//update the counter in tk1 in a 32-bit word-wise manner
+#define UPDATE_CTR(tk1) ({                                  \
+    tmp = ((uint32_t*)(tk1))[1];                            \
+    ((uint32_t*)(tk1))[1] = (tmp << 1) & 0x00ffffff;        \
+    ((uint32_t*)(tk1))[1] |= (((uint32_t*)(tk1))[0] >> 31); \
+    ((uint32_t*)(tk1))[1] |= tmp & 0xff000000;              \
+    ((uint32_t*)(tk1))[0] <<= 1;                            \
+    if ((tmp >> 23) & 0x01)                                 \
+        ((uint32_t*)(tk1))[0] ^= 0x95;                      \
+})
+
+//x <- y ^ z for 128-bit blocks
+#define XOR_BLOCK(x,y,z) ({                                             \
+    ((uint32_t*)(x))[0] = ((uint32_t*)(y))[0] ^ ((uint32_t*)(z))[0];    \
+    ((uint32_t*)(x))[1] = ((uint32_t*)(y))[1] ^ ((uint32_t*)(z))[1];    \
+    ((uint32_t*)(x))[2] = ((uint32_t*)(y))[2] ^ ((uint32_t*)(z))[2];    \
+    ((uint32_t*)(x))[3] = ((uint32_t*)(y))[3] ^ ((uint32_t*)(z))[3];    \
+})
+
+
+//Rho as defined in the Romulus specification
+//use pad as a tmp variable in case y = z
+#define RHO(x,y,z,tmp) ({       \
+    G(tmp,x);                   \
+    XOR_BLOCK(x, x, z);         \
+    XOR_BLOCK(y, tmp, z);       \
+})
+
+//Rho inverse as defined in the Romulus specification
+//use pad as a tmp variable in case y = z
+#define RHO_INV(x, y, z, tmp) ({    \
+    G(tmp, x);                      \
+    XOR_BLOCK(z, tmp, y);           \
+    XOR_BLOCK(x, x, z);             \
+})
+
+// Keystream chain run alongside the MAC chain during decryption
+typedef struct {
+    uint8_t state[BLOCKBYTES];
+    uint8_t tk1[TWEAKEYBYTES];
+    const uint8_t *rtk_23;
+    const uint8_t *c;
+    uint8_t *m;
+    unsigned long long mlen;
+    unsigned long long done;    // number of plaintext bytes already available
+} ks_chain;
+
+void zeroize(uint8_t buf[], unsigned long long buflen);
+
+// Romulus-M core functions defined in 'romulus_m.c'
+void romulusm_init(uint8_t *state, uint8_t *tk1);
+
+void romulusm_process_ad(
+    uint8_t *state,
+    const uint8_t *ad, unsigned long long adlen,
+    const unsigned char *m, unsigned long long mlen, uint8_t* rtk_23,
+    uint8_t *tk1, const uint8_t *npub, const uint8_t *k);
+
+void romulusm_process_ad_msg_dec(
+    uint8_t *state,
+    const uint8_t *ad, unsigned long long adlen,
+    uint8_t *m, const uint8_t *c, unsigned long long mlen, const uint8_t *tag,
+    const uint8_t *rtk_23, uint8_t *rtk_23_mac, uint8_t *tk1,
+    const uint8_t *npub, const uint8_t *k);
+
+void romulusm_process_msg(
+    uint8_t *out,
+    const uint8_t *in, unsigned long long inlen,
+    uint8_t *state, const uint8_t* rtk_23,
+    uint8_t *tk1,
+    const int mode);
+
+void romulusm_generate_tag(uint8_t *c, uint8_t *state);
+
+uint32_t romulusm_verify_tag(const uint8_t *tag, uint8_t *state);
+
+// Detached-tag interface: the tag is written to/read from its own buffer and
+// the output buffer may be the input one (in-place operation).
+// If the tag verification fails, decryption returns -1 and zeroizes the 'clen'
+// bytes of 'm', so that no unverified plaintext is released (in place, the
+// ciphertext is lost as well).
+// 'crypto_aead_encrypt' and 'crypto_aead_decrypt' are wrappers around them.
+int romulusm_encrypt_detached(
+    unsigned char *c, unsigned char *tag,
+    const unsigned char *m, unsigned long long mlen,
+    const unsigned char *ad, unsigned long long adlen,
+    const unsigned char *npub, const unsigned char *k);
+
+int romulusm_decrypt_detached(
+    unsigned char *m,
+    const unsigned char *c, unsigned long long clen,
+    const unsigned char *tag,
+    const unsigned char *ad, unsigned long long adlen,
+    const unsigned char *npub, const unsigned char *k);
+
+#endif  // ROMULUS_H_
@@ -12,9 +12,9 @@
 /**
  * Equivalent to 'memset(buf, 0x00, buflen)'.
  */
-static void zeroize(uint8_t buf[], int buflen)
+void zeroize(uint8_t buf[], unsigned long long buflen)
 {
-  int i;
+  unsigned long long i;
   for(i = 0; i < buflen; i++)
     buf[i] = 0x00;
 }
@@ -9,7 +9,26 @@
 #include "romulus_n.h"
 #include "crypto_aead.h"
 
-//Encryption and authentication using Romulus-N
+//Encryption and authentication using Romulus-N with a detached tag ('c' may be 'm')
+int romulusn_encrypt_detached
+    (unsigned char *c, unsigned char *tag,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    uint8_t state[BLOCKBYTES];
+    uint8_t tk1[TWEAKEYBYTES];
+    uint8_t rtk_23[BLOCKBYTES*SKINNY128_384_ROUNDS];
+    romulusn_init(state, tk1);
+    romulusn_process_ad(state, ad, adlen, rtk_23, tk1, npub, k);
+    romulusn_process_msg(c, m, mlen, state, rtk_23, tk1, ENCRYPT_MODE);
+    zeroize(rtk_23, BLOCKBYTES*SKINNY128_384_ROUNDS);
+    romulusn_generate_tag(tag, state);
+    return 0;
+}
+
+//Encryption and authentication using Romulus-N following the SUPERCOP API
 int crypto_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
@@ -19,19 +38,34 @@ int crypto_aead_encrypt
      const unsigned char *k)
 {
     (void)nsec;
-    uint8_t state[BLOCKBYTES];
+    *clen = mlen + TAGBYTES;
+    return romulusn_encrypt_detached(c, c + mlen, m, mlen, ad, adlen, npub, k);
+}
+
+//Decryption and tag verification using Romulus-N with a detached tag ('m' may be 'c')
+int romulusn_decrypt_detached
+    (unsigned char *m,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *tag,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
     uint8_t tk1[TWEAKEYBYTES];
+    uint8_t state[BLOCKBYTES];
     uint8_t rtk_23[BLOCKBYTES*SKINNY128_384_ROUNDS];
-    *clen = mlen + TAGBYTES;
     romulusn_init(state, tk1);
     romulusn_process_ad(state, ad, adlen, rtk_23, tk1, npub, k);
-    romulusn_process_msg(c, m, mlen, state, rtk_23, tk1, ENCRYPT_MODE);
+    romulusn_process_msg(m, c, clen, state, rtk_23, tk1, DECRYPT_MODE);
     zeroize(rtk_23, BLOCKBYTES*SKINNY128_384_ROUNDS);
-    romulusn_generate_tag(c+mlen, state);
+    if (romulusn_verify_tag(tag, state)) {  // unverified plaintext is never released
+        zeroize(m, clen);
+        return -1;
+    }
     return 0;
 }
 
-//Decryption and tag verification using Romulus-N
+//Decryption and tag verification using Romulus-N following the SUPERCOP API
 int crypto_aead_decrypt
     (unsigned char *m, unsigned long long *mlen,
      unsigned char *nsec,
@@ -41,18 +75,8 @@ int crypto_aead_decrypt
      const unsigned char *k)
 {
     (void)nsec;
-    uint8_t tk1[TWEAKEYBYTES];
-    uint8_t state[BLOCKBYTES];
-    uint8_t rtk_23[BLOCKBYTES*SKINNY128_384_ROUNDS];
-
     if (clen < TAGBYTES)
         return -1;
-
-    clen -= TAGBYTES;
-    *mlen = clen;
-    romulusn_init(state, tk1);
-    romulusn_process_ad(state, ad, adlen, rtk_23, tk1, npub, k);
-    romulusn_process_msg(m, c, clen, state, rtk_23, tk1, DECRYPT_MODE);
-    zeroize(rtk_23, BLOCKBYTES*SKINNY128_384_ROUNDS);
-    return romulusn_verify_tag(c+clen, state);
+    *mlen = clen - TAGBYTES;
+    return romulusn_decrypt_detached(m, c, *mlen, c + *mlen, ad, adlen, npub, k);
 }
@@ -22,9 +22,9 @@ static void copy(uint8_t dest[], const uint8_t src[], int srclen)
 /**
  * Equivalent to 'memset(buf, 0x00, buflen)'.
  */
-void zeroize(uint8_t buf[], int buflen)
+void zeroize(uint8_t buf[], unsigned long long buflen)
 {
-  int i;
+  unsigned long long i;
   for(i = 0; i < buflen; i++)
     buf[i] = 0x00;
 }
@@ -0,0 +1,158 @@
+/**
+ * Scatter-gather (iovec) interface of Romulus-N and the fragment cursor used
+ * to walk the input/output buffers without linearizing them.
+ * 
+ * A block which lies within a single fragment is processed in place, while a
+ * block straddling fragment boundaries is gathered into (resp. scattered from)
+ * a 16-byte buffer on the stack.
+ * 
+ * @date        October 2026
+ */
+#ifndef ROMULUS_IOV_H_
+#define ROMULUS_IOV_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/uio.h>
+
+/**
+ * Romulus-N encryption of the concatenation of the 'incnt' fragments of 'in'
+ * into the fragments of 'out' (which may be the ones of 'in', in which case
+ * the encryption is done in place), with the concatenation of the 'adcnt'
+ * fragments of 'ad' as associated data. The tag is written to 'tag'.
+ * Returns -1 if the output fragments are too short.
+ */
+int romulusn_encrypt_iov(
+    const struct iovec *ad, int adcnt,
+    const struct iovec *in, int incnt,
+    const struct iovec *out, int outcnt,
+    unsigned char *tag,
+    const unsigned char *npub,
+    const unsigned char *k);
+
+/**
+ * Romulus-N decryption counterpart of 'romulusn_encrypt_iov'.
+ * Returns -1 if the output fragments are too short or if the tag verification
+ * fails, in which case the output fragments are zeroized over the length of
+ * the input.
+ */
+int romulusn_decrypt_iov(
+    const struct iovec *ad, int adcnt,
+    const struct iovec *in, int incnt,
+    const struct iovec *out, int outcnt,
+    const unsigned char *tag,
+    const unsigned char *npub,
+    const unsigned char *k);
+
+typedef struct {
+    const struct iovec *iov;    // current fragment
+    const struct iovec *end;    // past the last fragment
+    size_t off;                 // offset within the current fragment
+} iov_cursor;
+
+static inline unsigned long long iov_total(const struct iovec *iov, int cnt)
+{
+    unsigned long long len = 0;
+    for(int i = 0; i < cnt; i++)
+        len += iov[i].iov_len;
+    return len;
+}
+
+static inline void iov_init(iov_cursor *cur, const struct iovec *iov, int cnt)
+{
+    cur->iov = iov;
+    cur->end = iov + cnt;
+    cur->off = 0;
+}
+
+/**
+ * Number of contiguous bytes available at the cursor (empty fragments are
+ * skipped).
+ */
+static inline size_t iov_contig(iov_cursor *cur)
+{
+    while (cur->iov < cur->end && cur->off == cur->iov->iov_len) {
+        cur->iov++;
+        cur->off = 0;
+    }
+    return (cur->iov < cur->end) ? cur->iov->iov_len - cur->off : 0;
+}
+
+static inline uint8_t *iov_ptr(const iov_cursor *cur)
+{
+    return (uint8_t *)cur->iov->iov_base + cur->off;
+}
+
+/**
+ * Advance the cursor by 'len' bytes, which must be contiguous.
+ */
+static inline void iov_skip(iov_cursor *cur, size_t len)
+{
+    cur->off += len;
+}
+
+/**
+ * Copy the next 'len' bytes into 'buf' and advance the cursor.
+ */
+static inline void iov_read(iov_cursor *cur, uint8_t *buf, size_t len)
+{
+    size_t n;
+    while (len > 0) {
+        n = iov_contig(cur);
+        n = (n < len) ? n : len;
+        for(size_t i = 0; i < n; i++)
+            buf[i] = iov_ptr(cur)[i];
+        iov_skip(cur, n);
+        buf += n;
+        len -= n;
+    }
+}
+
+/**
+ * Copy 'len' bytes from 'buf' at the cursor position and advance the cursor.
+ */
+static inline void iov_write(iov_cursor *cur, const uint8_t *buf, size_t len)
+{
+    size_t n;
+    while (len > 0) {
+        n = iov_contig(cur);
+        n = (n < len) ? n : len;
+        for(size_t i = 0; i < n; i++)
+            iov_ptr(cur)[i] = buf[i];
+        iov_skip(cur, n);
+        buf += n;
+        len -= n;
+    }
+}
+
+/**
+ * Zeroize the first 'len' bytes of the fragments.
+ */
+static inline void iov_zeroize(const struct iovec *iov, int cnt,
+    unsigned long long len)
+{
+    for(int i = 0; i < cnt && len > 0; i++) {
+        size_t n = (iov[i].iov_len < len) ? iov[i].iov_len : (size_t)len;
+        for(size_t j = 0; j < n; j++)
+            ((uint8_t *)iov[i].iov_base)[j] = 0x00;
+        len -= n;
+    }
+}
+
+/**
+ * Return a pointer to the next 'len' bytes and advance the cursor: points
+ * directly into the fragment if they are contiguous, into 'buf' otherwise.
+ */
+static inline const uint8_t *iov_block(iov_cursor *cur, uint8_t *buf, size_t len)
+{
+    const uint8_t *ptr;
+    if (iov_contig(cur) >= len) {
+        ptr = iov_ptr(cur);
+        iov_skip(cur, len);
+        return ptr;
+    }
+    iov_read(cur, buf, len);
+    return buf;
+}
+
+#endif  // ROMULUS_IOV_H_
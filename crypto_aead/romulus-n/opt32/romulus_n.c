@@ -11,9 +11,9 @@
 /**
  * Equivalent to 'memset(buf, 0x00, buflen)'.
  */
-void zeroize(uint8_t buf[], int buflen)
+void zeroize(uint8_t buf[], unsigned long long buflen)
 {
-  int i;
+  unsigned long long i;
   for(i = 0; i < buflen; i++)
     buf[i] = 0x00;
 }
@@ -40,27 +40,30 @@ void romulusn_init(uint8_t *state, uint8_t *tk1)
 
 /**
  * Process the additional data and updates the internal state accordingly.
+ * Returns a non-zero value if a fault has been detected (only relevant for
+ * the redundant implementation).
  */
-void romulusn_process_ad(
+uint32_t romulusn_process_ad(
     uint8_t *state, const uint8_t *ad, unsigned long long adlen,
     uint32_t *rtk_23, uint8_t *tk1, const uint8_t *npub, const uint8_t *k)
 {
+    uint32_t fault = 0;
     int i;
     uint32_t tmp;
-    uint32_t rtk_1[TKPERMORDER*BLOCKBYTES/4];
+    uint32_t rtk_1[RTK1_WORDS];
     uint8_t pad[BLOCKBYTES];
     if (adlen == 0) {
         UPDATE_CTR(tk1);
         SET_DOMAIN(tk1, 0x1A);
         tk_schedule_123(rtk_1, rtk_23, tk1, npub, k);
-        skinny128_384_plus(state, state, rtk_1, rtk_23);
+        SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
     } else {    // Process all double blocks except the last
         SET_DOMAIN(tk1, 0x08);
         while (adlen > 2*BLOCKBYTES) {
             UPDATE_CTR(tk1);
             XOR_BLOCK(state, state, ad);
             tk_schedule_123(rtk_1, rtk_23, tk1, ad + BLOCKBYTES, k);
-            skinny128_384_plus(state, state, rtk_1, rtk_23);
+            SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
             UPDATE_CTR(tk1);
             ad += 2*BLOCKBYTES;
             adlen -= 2*BLOCKBYTES;
@@ -70,7 +73,7 @@ void romulusn_process_ad(
         if (adlen == 2*BLOCKBYTES) {        // Left-over complete double block
             XOR_BLOCK(state, state, ad);
             tk_schedule_123(rtk_1, rtk_23, tk1, ad + BLOCKBYTES, k);
-            skinny128_384_plus(state, state, rtk_1, rtk_23);
+            SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
             UPDATE_CTR(tk1);
             SET_DOMAIN(tk1, 0x18);
         } else if (adlen > BLOCKBYTES) {    //  Left-over partial double block
@@ -80,7 +83,7 @@ void romulusn_process_ad(
             zeroize(pad + adlen, 15 - adlen);
             pad[15] = adlen;
             tk_schedule_123(rtk_1, rtk_23, tk1, pad, k);
-            skinny128_384_plus(state, state, rtk_1, rtk_23);
+            SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
             UPDATE_CTR(tk1);
             SET_DOMAIN(tk1, 0x1A);
         } else if (adlen == BLOCKBYTES) {   //  Left-over complete single block 
@@ -93,39 +96,44 @@ void romulusn_process_ad(
             SET_DOMAIN(tk1, 0x1A);
         }
         tk_schedule_123(rtk_1, rtk_23, tk1, npub, k);
-        skinny128_384_plus(state, state, rtk_1, rtk_23);
+        SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
     }
+    return fault;
 }
 
 /**
  * Process the message and updates the internal state as well as the output
  * buffer accordingly.
+ * Returns a non-zero value if a fault has been detected (only relevant for
+ * the redundant implementation).
  */
-void romulusn_process_msg(
+uint32_t romulusn_process_msg(
     uint8_t *out, const uint8_t *in, unsigned long long inlen,
     uint8_t *state, const uint32_t *rtk_23, uint8_t *tk1, const int mode)
 {
+    uint32_t fault = 0;
     int i;
     uint32_t tmp;
     uint8_t tmp_blk[BLOCKBYTES];
-    uint32_t rtk_1[TKPERMORDER*BLOCKBYTES/4];
+    uint32_t rtk_1[RTK1_WORDS];
     zeroize(tk1, TWEAKEYBYTES);
     tk1[0] = 0x01;          //init the 56-bit LFSR counter
     if (inlen == 0) {
         UPDATE_CTR(tk1);
         SET_DOMAIN(tk1, 0x15);
         tk_schedule_1(rtk_1, tk1);
-        skinny128_384_plus(state, state, rtk_1, rtk_23);
+        SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
     } else {        //process all blocks except the last
         SET_DOMAIN(tk1, 0x04);
+        tk_schedule_1(rtk_1, tk1);
         while (inlen > BLOCKBYTES) {
             if(mode == ENCRYPT_MODE)
                 RHO(state, out, in, tmp_blk);
             else
                 RHO_INV(state, in, out, tmp_blk);
             UPDATE_CTR(tk1);
-            tk_schedule_1(rtk_1, tk1);
-            skinny128_384_plus(state, state, rtk_1, rtk_23);
+            tk_update_1(rtk_1);     // no need to recompute the entire schedule
+            SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
             out     += BLOCKBYTES;
             in      += BLOCKBYTES;
             inlen   -= BLOCKBYTES;
@@ -155,8 +163,9 @@ void romulusn_process_msg(
             SET_DOMAIN(tk1, 0x14);
         }
         tk_schedule_1(rtk_1, tk1);
-        skinny128_384_plus(state, state, rtk_1, rtk_23);
+        SKINNY128_384_PLUS(state, state, rtk_1, rtk_23);
     }
+    return fault;
 }
 
 /**
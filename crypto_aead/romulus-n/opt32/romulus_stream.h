@@ -0,0 +1,87 @@
+/**
+ * Online (STREAM) interface of Romulus-N.
+ * 
+ * A stream is a sequence of segments, each of them being sealed by an
+ * independent Romulus-N call under the nonce
+ * 
+ *   nonce_prefix (11 bytes) || segment index (32-bit big-endian) || last
+ * 
+ * where 'last' is 0x01 for the final segment and 0x00 otherwise, following
+ * the STREAM construction of Hoang, Reyhanitabar, Rogaway and Vizár. Reordered,
+ * dropped or duplicated segments as well as truncation of the stream are
+ * detected, while only one segment needs to be buffered at a time. A nonce
+ * prefix must never be reused with the same key.
+ * 
+ * @date        October 2026
+ */
+#ifndef ROMULUS_STREAM_H_
+#define ROMULUS_STREAM_H_
+
+#include <stdint.h>
+
+#define STREAM_PREFIXBYTES  11
+
+typedef struct {
+    uint8_t k[16];
+    uint8_t prefix[STREAM_PREFIXBYTES];
+    uint8_t status;     // 0: open, 1: final segment processed, 2: failed
+    uint32_t index;     // index of the next segment
+} romulusn_stream;
+
+/**
+ * Initialize a stream with the 16-byte key 'k' and the 11-byte nonce prefix.
+ */
+void romulusn_stream_init(
+    romulusn_stream *st,
+    const unsigned char *k,
+    const unsigned char *nonce_prefix);
+
+/**
+ * Seal the next segment 'm' into 'c' (which may be 'm') and write its tag.
+ * 'last' must be non-zero for the final segment, after which the key is
+ * erased from the stream state.
+ * Returns -1 if the stream is already finished or exceeds 2^32 segments.
+ */
+int romulusn_stream_seal_segment(
+    romulusn_stream *st,
+    unsigned char *c, unsigned char *tag,
+    const unsigned char *m, unsigned long long mlen,
+    const unsigned char *ad, unsigned long long adlen,
+    int last);
+
+/**
+ * Open the next segment 'c' into 'm' (which may be 'c').
+ * Returns a non-zero value if the stream is already finished or if the tag
+ * verification fails, in which case 'm' is zeroized and the stream cannot be
+ * used anymore.
+ */
+int romulusn_stream_open_segment(
+    romulusn_stream *st,
+    unsigned char *m,
+    const unsigned char *c, unsigned long long clen,
+    const unsigned char *tag,
+    const unsigned char *ad, unsigned long long adlen,
+    int last);
+
+/**
+ * Seal/open the segment at position 'index' without updating the stream
+ * state, so that several segments can be processed concurrently (e.g. one per
+ * thread). The caller is responsible for using each index once and for
+ * setting 'last' on the final segment only.
+ */
+int romulusn_stream_seal_segment_at(
+    const romulusn_stream *st, uint32_t index,
+    unsigned char *c, unsigned char *tag,
+    const unsigned char *m, unsigned long long mlen,
+    const unsigned char *ad, unsigned long long adlen,
+    int last);
+
+int romulusn_stream_open_segment_at(
+    const romulusn_stream *st, uint32_t index,
+    unsigned char *m,
+    const unsigned char *c, unsigned long long clen,
+    const unsigned char *tag,
+    const unsigned char *ad, unsigned long long adlen,
+    int last);
+
+#endif  // ROMULUS_STREAM_H_
@@ -22,6 +22,7 @@
 #include <string.h>
 #include "skinny128.h"
 #include "tk_schedule.h"
+#include "skinny_stats.h"
 
 /******************************************************************************
 * The MixColumns computation for rounds i such that (i % 4) == 0
@@ -83,6 +84,70 @@ void mixcolumns_3(uint32_t* state) {
 	}
 }
 
+#if defined(ROMULUS_PROFILE_SMALL)
+/******************************************************************************
+* Encryption of a single block without any operation mode using SKINNY-128-384.
+* RTK1 and RTK2_3 only contain the packed TK1 and TK2/TK3, respectively: the
+* round tweakeys are computed on-the-fly, 8 rounds at a time, so that only 128
+* bytes are needed to store them.
+******************************************************************************/
+void skinny128_384_plus(
+	uint8_t* ctext, const uint8_t* ptext, 
+	const uint32_t* rtk1,  const uint32_t* rtk2_3)
+{
+	SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 1);
+	uint32_t tmp; 					// used in SWAPMOVE macro
+	uint32_t state[4]; 				// 128-bit state
+	uint32_t rtk[32]; 				// round tweakeys for 8 rounds
+	uint32_t tk[4], tk2[4], tk3[4];
+	memcpy(tk2, rtk2_3, 16);
+	memcpy(tk3, rtk2_3+4, 16);
+	for(int j = 0; j < 4; j++)
+		tk[j] = rtk1[j] ^ tk2[j] ^ tk3[j];
+	packing(state, ptext); 			// from byte to bitsliced representation
+	for(int i = 0; i < SKINNY128_384_ROUNDS; i += 8) {
+		for(int j = 4; j < 32; j += 8) {
+			lfsr2_bs(tk2);
+			lfsr3_bs(tk3);
+			rtk[j] 	 = tk2[0] ^ tk3[0];
+			rtk[j+1] = tk2[1] ^ tk3[1];
+			rtk[j+2] = tk2[2] ^ tk3[2];
+			rtk[j+3] = tk2[3] ^ tk3[3];
+		}
+		permute_tk_8rounds(rtk, tk, rtk1, (i % 16 < 8));
+		QUADRUPLE_ROUND(state, rtk, 	rconst_32_bs+i*4);
+		QUADRUPLE_ROUND(state, rtk+16, 	rconst_32_bs+i*4+16);
+	}
+	unpacking(ctext, state);		// from bitsliced to byte representation
+	SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+#elif defined(ROMULUS_PROFILE_BALANCED)
+/******************************************************************************
+* Encryption of a single block without any operation mode using SKINNY-128-384.
+* RTK1 only contains the packed TK1: the related round tweakeys are computed
+* on-the-fly, 8 rounds at a time, while RTK2_3 is assumed to be precomputed.
+******************************************************************************/
+void skinny128_384_plus(
+	uint8_t* ctext, const uint8_t* ptext, 
+	const uint32_t* rtk1,  const uint32_t* rtk2_3)
+{
+	SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 1);
+	uint32_t tmp; 					// used in SWAPMOVE macro
+	uint32_t state[4]; 				// 128-bit state
+	uint32_t rtk[32]; 				// round tweakeys for 8 rounds
+	uint32_t tk[4];
+	memcpy(tk, rtk1, 16);
+	packing(state, ptext); 			// from byte to bitsliced representation
+	for(int i = 0; i < SKINNY128_384_ROUNDS; i += 8) {
+		memset(rtk, 0x00, sizeof(rtk));
+		permute_tk_8rounds(rtk, tk, rtk1, (i % 16 < 8));
+		QUADRUPLE_ROUND(state, rtk, 	rtk2_3+i*4);
+		QUADRUPLE_ROUND(state, rtk+16, 	rtk2_3+i*4+16);
+	}
+	unpacking(ctext, state);		// from bitsliced to byte representation
+	SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+#else
 /******************************************************************************
 * Encryption of a single block without any operation mode using SKINNY-128-384.
 * RTK1 and RTK2_3 are given separately to take advantage of the fact that
@@ -92,6 +157,7 @@ void skinny128_384_plus(
 	uint8_t* ctext, const uint8_t* ptext, 
 	const uint32_t* rtk1,  const uint32_t* rtk2_3)
 {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 1);
 	uint32_t tmp; 					// used in SWAPMOVE macro
 	uint32_t state[4]; 				// 128-bit state
 	packing(state, ptext); 			// from byte to bitsliced representation
@@ -106,4 +172,6 @@ void skinny128_384_plus(
 	QUADRUPLE_ROUND(state, rtk1, 	rtk2_3+128);
 	QUADRUPLE_ROUND(state, rtk1+16, rtk2_3+144);
 	unpacking(ctext, state);		// from bitsliced to byte representation
-}
\ No newline at end of file
+	SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+#endif
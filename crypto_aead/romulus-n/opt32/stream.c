@@ -0,0 +1,126 @@
+/**
+ * Romulus-N online (STREAM) interface (see 'romulus_stream.h').
+ * 
+ * @date        October 2026
+ */
+#include "romulus_n.h"
+#include "romulus_stream.h"
+
+#define STREAM_OPEN     0
+#define STREAM_FINAL    1
+#define STREAM_FAILED   2
+
+/**
+ * Nonce of the segment at position 'index'.
+ */
+static void stream_nonce(
+    uint8_t npub[BLOCKBYTES], const romulusn_stream *st,
+    uint32_t index, int last)
+{
+    int i;
+    for(i = 0; i < STREAM_PREFIXBYTES; i++)
+        npub[i] = st->prefix[i];
+    npub[11] = (uint8_t)(index >> 24);
+    npub[12] = (uint8_t)(index >> 16);
+    npub[13] = (uint8_t)(index >> 8);
+    npub[14] = (uint8_t)index;
+    npub[15] = last ? 0x01 : 0x00;
+}
+
+/**
+ * Returns -1 if no more segments can be processed.
+ */
+static int stream_check(const romulusn_stream *st, int last)
+{
+    if (st->status != STREAM_OPEN || (!last && st->index == UINT32_MAX))
+        return -1;
+    return 0;
+}
+
+/**
+ * Moves to the next segment, the key being erased after the final one.
+ */
+static void stream_advance(romulusn_stream *st, int last)
+{
+    st->index++;
+    if (last) {
+        st->status = STREAM_FINAL;
+        zeroize(st->k, sizeof(st->k));
+    }
+}
+
+void romulusn_stream_init(
+    romulusn_stream *st,
+    const unsigned char *k,
+    const unsigned char *nonce_prefix)
+{
+    int i;
+    for(i = 0; i < (int)sizeof(st->k); i++)
+        st->k[i] = k[i];
+    for(i = 0; i < STREAM_PREFIXBYTES; i++)
+        st->prefix[i] = nonce_prefix[i];
+    st->status = STREAM_OPEN;
+    st->index = 0;
+}
+
+int romulusn_stream_seal_segment_at(
+    const romulusn_stream *st, uint32_t index,
+    unsigned char *c, unsigned char *tag,
+    const unsigned char *m, unsigned long long mlen,
+    const unsigned char *ad, unsigned long long adlen,
+    int last)
+{
+    uint8_t npub[BLOCKBYTES];
+    stream_nonce(npub, st, index, last);
+    return romulusn_encrypt_detached(c, tag, m, mlen, ad, adlen, npub, st->k);
+}
+
+int romulusn_stream_open_segment_at(
+    const romulusn_stream *st, uint32_t index,
+    unsigned char *m,
+    const unsigned char *c, unsigned long long clen,
+    const unsigned char *tag,
+    const unsigned char *ad, unsigned long long adlen,
+    int last)
+{
+    uint8_t npub[BLOCKBYTES];
+    stream_nonce(npub, st, index, last);
+    // 'm' is zeroized by 'romulusn_decrypt_detached' if the tag is invalid
+    return romulusn_decrypt_detached(m, c, clen, tag, ad, adlen, npub, st->k);
+}
+
+int romulusn_stream_seal_segment(
+    romulusn_stream *st,
+    unsigned char *c, unsigned char *tag,
+    const unsigned char *m, unsigned long long mlen,
+    const unsigned char *ad, unsigned long long adlen,
+    int last)
+{
+    if (stream_check(st, last))
+        return -1;
+    if (romulusn_stream_seal_segment_at(st, st->index, c, tag, m, mlen,
+        ad, adlen, last))
+        return -1;
+    stream_advance(st, last);
+    return 0;
+}
+
+int romulusn_stream_open_segment(
+    romulusn_stream *st,
+    unsigned char *m,
+    const unsigned char *c, unsigned long long clen,
+    const unsigned char *tag,
+    const unsigned char *ad, unsigned long long adlen,
+    int last)
+{
+    if (stream_check(st, last))
+        return -1;
+    if (romulusn_stream_open_segment_at(st, st->index, m, c, clen, tag,
+        ad, adlen, last)) {
+        st->status = STREAM_FAILED;
+        zeroize(st->k, sizeof(st->k));
+        return -1;
+    }
+    stream_advance(st, last);
+    return 0;
+}
@@ -16,6 +16,7 @@
 #include <stdint.h>
 #include "tk_schedule.h"
 #include "skinny128.h"
+#include "skinny_stats.h"
 
 /******************************************************************************
 * The round constants according to the new representation.
@@ -262,104 +263,307 @@ void precompute_lfsr_tk3(uint32_t* tk, const uint8_t* key, const int rounds) {
 	}
 }
 
+/******************************************************************************
+* Rearrange the round tweakeys of 8 consecutive rounds (i.e. 32 words) to match
+* the fixsliced representation. The odd rounds are read from 'tk' while the
+* first round is read from 'tmp', which is then updated for the next call.
+* TK1 is XORed on the fly, 'test' selects the right powers of P.
+******************************************************************************/
+void permute_tk_8rounds(uint32_t* tk, uint32_t* tmp, const uint32_t* tk1,
+	const int test) {
+	tk[0] = tmp[2] & 0xf0f0f0f0;
+	tk[1] = tmp[3] & 0xf0f0f0f0;
+	tk[2] = tmp[0] & 0xf0f0f0f0;
+	tk[3] = tmp[1] & 0xf0f0f0f0;
+	memcpy(tmp, tk+4, 16);
+	XOR_BLOCKS(tmp, tk1);
+	if (test)
+		permute_tk_2(tmp); 					// applies P^2
+	else
+		permute_tk_10(tmp); 				// applies P^10
+	tk[4] = ROR(tmp[0],26) & 0xc3c3c3c3;
+	tk[5] = ROR(tmp[1],26) & 0xc3c3c3c3;
+	tk[6] = ROR(tmp[2],26) & 0xc3c3c3c3;
+	tk[7] = ROR(tmp[3],26) & 0xc3c3c3c3;
+	tk[8] = ROR(tmp[2],28) & 0x03030303;
+	tk[8] |= ROR(tmp[2],12) & 0x0c0c0c0c;
+	tk[9] = ROR(tmp[3],28) & 0x03030303;
+	tk[9] |= ROR(tmp[3],12) & 0x0c0c0c0c;
+	tk[10] = ROR(tmp[0],28) & 0x03030303;
+	tk[10] |= ROR(tmp[0],12) & 0x0c0c0c0c;
+	tk[11] = ROR(tmp[1],28) & 0x03030303;
+	tk[11] |= ROR(tmp[1],12) & 0x0c0c0c0c;
+	memcpy(tmp, tk+12, 16);
+	XOR_BLOCKS(tmp, tk1);
+	if (test)
+		permute_tk_4(tmp); 					// applies P^4
+	else
+		permute_tk_12(tmp); 				// applies P^12
+	for(int j = 0; j < 4; j++) {
+		tk[12+j] = ROR(tmp[j],14) & 0x30303030;
+		tk[12+j] |= ROR(tmp[j],6) & 0x0c0c0c0c;
+	}
+	tk[16] = ROR(tmp[2], 16) & 0xf0f0f0f0;
+	tk[17] = ROR(tmp[3], 16) & 0xf0f0f0f0;
+	tk[18] = ROR(tmp[0], 16) & 0xf0f0f0f0;
+	tk[19] = ROR(tmp[1], 16) & 0xf0f0f0f0;
+	memcpy(tmp, tk+20, 16);
+	XOR_BLOCKS(tmp, tk1);
+	if (test)
+		permute_tk_6(tmp); 					//	applies P^6
+	else
+		permute_tk_14(tmp); 				// applies P^14
+	tk[20] 	= ROR(tmp[0], 10) & 0xc3c3c3c3;
+	tk[21] 	= ROR(tmp[1], 10) & 0xc3c3c3c3;
+	tk[22] 	= ROR(tmp[2], 10) & 0xc3c3c3c3;
+	tk[23] 	= ROR(tmp[3], 10) & 0xc3c3c3c3;
+	tk[24] 	= ROR(tmp[2], 12) & 0x03030303;
+	tk[24] |= ROR(tmp[2], 28) & 0x0c0c0c0c;
+	tk[25] 	= ROR(tmp[3], 12) & 0x03030303;
+	tk[25] |= ROR(tmp[3], 28) & 0x0c0c0c0c;
+	tk[26] 	= ROR(tmp[0], 12) & 0x03030303;
+	tk[26] |= ROR(tmp[0], 28) & 0x0c0c0c0c;
+	tk[27] 	= ROR(tmp[1], 12) & 0x03030303;
+	tk[27] |= ROR(tmp[1], 28) & 0x0c0c0c0c;
+	memcpy(tmp, tk+28, 16);
+	XOR_BLOCKS(tmp, tk1);
+	if (test)
+		permute_tk_8(tmp); 					// applies P^8
+	for(int j = 0; j < 4; j++) {
+		tk[28+j] = ROR(tmp[j],30) & 0x30303030;
+		tk[28+j] |= ROR(tmp[j],22) & 0x0c0c0c0c;
+	}
+}
+
 /******************************************************************************
 * XOR TK with TK1 before applying the permutations.
 * The key is then rearranged to match the fixsliced representation.
 ******************************************************************************/
 void permute_tk(uint32_t* tk, const uint8_t* key, const int rounds) {
-	uint32_t test;
 	uint32_t tk1[4], tmp[4];
 	packing(tk1, key);
 	memcpy(tmp, tk, 16);
-	tmp[0] ^= tk1[0];
-	tmp[1] ^= tk1[1];
-	tmp[2] ^= tk1[2];
-	tmp[3] ^= tk1[3];
-	for(int i = 0 ; i < rounds; i += 8) {
-		test = (i % 16 < 8) ? 1 : 0; 			//to apply the right power of P
-		tk[i*4] = tmp[2] & 0xf0f0f0f0;
-		tk[i*4+1] = tmp[3] & 0xf0f0f0f0;
-		tk[i*4+2] = tmp[0] & 0xf0f0f0f0;
-		tk[i*4+3] = tmp[1] & 0xf0f0f0f0;
-		memcpy(tmp, tk+i*4+4, 16);
-		XOR_BLOCKS(tmp, tk1);
-		if (test)
-			permute_tk_2(tmp); 					// applies P^2
-		else
-			permute_tk_10(tmp); 				// applies P^10
-		tk[i*4+4] = ROR(tmp[0],26) & 0xc3c3c3c3;
-		tk[i*4+5] = ROR(tmp[1],26) & 0xc3c3c3c3;
-		tk[i*4+6] = ROR(tmp[2],26) & 0xc3c3c3c3;
-		tk[i*4+7] = ROR(tmp[3],26) & 0xc3c3c3c3;
-		tk[i*4+8] = ROR(tmp[2],28) & 0x03030303;
-		tk[i*4+8] |= ROR(tmp[2],12) & 0x0c0c0c0c;
-		tk[i*4+9] = ROR(tmp[3],28) & 0x03030303;
-		tk[i*4+9] |= ROR(tmp[3],12) & 0x0c0c0c0c;
-		tk[i*4+10] = ROR(tmp[0],28) & 0x03030303;
-		tk[i*4+10] |= ROR(tmp[0],12) & 0x0c0c0c0c;
-		tk[i*4+11] = ROR(tmp[1],28) & 0x03030303;
-		tk[i*4+11] |= ROR(tmp[1],12) & 0x0c0c0c0c;
-		memcpy(tmp, tk+i*4+12, 16);
-		XOR_BLOCKS(tmp, tk1);
-		if (test)
-			permute_tk_4(tmp); 					// applies P^4
-		else
-			permute_tk_12(tmp); 				// applies P^12
-		for(int j = 0; j < 4; j++) {
-			tk[i*4+12+j] = ROR(tmp[j],14) & 0x30303030;
-			tk[i*4+12+j] |= ROR(tmp[j],6) & 0x0c0c0c0c;
-		}
-		tk[i*4+16] = ROR(tmp[2], 16) & 0xf0f0f0f0;
-		tk[i*4+17] = ROR(tmp[3], 16) & 0xf0f0f0f0;
-		tk[i*4+18] = ROR(tmp[0], 16) & 0xf0f0f0f0;
-		tk[i*4+19] = ROR(tmp[1], 16) & 0xf0f0f0f0;
-		memcpy(tmp, tk+i*4+20, 16);
-		XOR_BLOCKS(tmp, tk1);
-		if (test)
-			permute_tk_6(tmp); 					//	applies P^6
-		else
-			permute_tk_14(tmp); 				// applies P^14
-		tk[i*4+20] 	= ROR(tmp[0], 10) & 0xc3c3c3c3;
-		tk[i*4+21] 	= ROR(tmp[1], 10) & 0xc3c3c3c3;
-		tk[i*4+22] 	= ROR(tmp[2], 10) & 0xc3c3c3c3;
-		tk[i*4+23] 	= ROR(tmp[3], 10) & 0xc3c3c3c3;
-		tk[i*4+24] 	= ROR(tmp[2], 12) & 0x03030303;
-		tk[i*4+24] |= ROR(tmp[2], 28) & 0x0c0c0c0c;
-		tk[i*4+25] 	= ROR(tmp[3], 12) & 0x03030303;
-		tk[i*4+25] |= ROR(tmp[3], 28) & 0x0c0c0c0c;
-		tk[i*4+26] 	= ROR(tmp[0], 12) & 0x03030303;
-		tk[i*4+26] |= ROR(tmp[0], 28) & 0x0c0c0c0c;
-		tk[i*4+27] 	= ROR(tmp[1], 12) & 0x03030303;
-		tk[i*4+27] |= ROR(tmp[1], 28) & 0x0c0c0c0c;
-		memcpy(tmp, tk+i*4+28, 16);
-		XOR_BLOCKS(tmp, tk1);
-		if (test)
-			permute_tk_8(tmp); 					// applies P^8
-		for(int j = 0; j < 4; j++) {
-			tk[i*4+28+j] = ROR(tmp[j],30) & 0x30303030;
-			tk[i*4+28+j] |= ROR(tmp[j],22) & 0x0c0c0c0c;
-		}
-		if (test && (i+8 < rounds)) { 			//only if next loop iteration
-			tk[i*4+32] = tmp[2] & 0xf0f0f0f0;
-			tk[i*4+33] = tmp[3] & 0xf0f0f0f0;
-			tk[i*4+34] = tmp[0] & 0xf0f0f0f0;
-			tk[i*4+35] = tmp[1] & 0xf0f0f0f0;
-		}
-	}
+	XOR_BLOCKS(tmp, tk1);
+	for(int i = 0 ; i < rounds; i += 8) 		//to apply the right power of P
+		permute_tk_8rounds(tk + i*4, tmp, tk1, (i % 16 < 8));
 }
 
+#if defined(ROMULUS_PROFILE_FAST)
 /******************************************************************************
 * Precompute RTK1.
 ******************************************************************************/
 void tk_schedule_1(uint32_t* rtk1, const uint8_t* tk1) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_1, 1);
 	memset(rtk1, 0x00, 16*16);
 	permute_tk(rtk1, tk1, 16);
+	SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_1);
+}
+
+/******************************************************************************
+* Update RTK1 in place to match the next value of the 56-bit LFSR counter used
+* in Romulus (i.e. equivalent to 'UPDATE_CTR' followed by 'tk_schedule_1').
+* The LFSR step is directly applied in the fixsliced representation: within a
+* byte, bit i is moved to bit i+1 by swapping the bitsliced words, while the
+* carries from one byte to the next are handled by masked rotations.
+* Only valid when the lower half of TK1 is null, as in Romulus-N/M/T.
+******************************************************************************/
+void tk_update_1(uint32_t* rtk_1) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_TK_UPDATE_1, 1);
+	uint32_t w0, w1, w2, w3, fb;
+	w0 = rtk_1[0]; w1 = rtk_1[1]; w2 = rtk_1[2]; w3 = rtk_1[3];
+	fb = (w2 >> 21) & 0x01;
+	rtk_1[0] = w0 ^ ((w0 ^ w1) & 0xc0f0f0f0);
+	rtk_1[3] = w3 ^ ((w3 ^ w0) & 0xc0f0f0f0) ^ (fb << 6);
+	rtk_1[1] = w1 & 0x30000000;
+	rtk_1[1] |= (w2 << 1) & 0x80a0a0a0;
+	rtk_1[1] |= ROR(w2 & 0x00200000, 15);
+	rtk_1[1] |= ROR(w2 & 0x0080a0a0, 25);
+	rtk_1[1] |= ROR(w2 & 0x80000000, 27);
+	rtk_1[1] ^= fb << 7;
+	rtk_1[2] = w2 ^ ((w2 ^ w3) & 0xc0f0f0f0) ^ (fb << 7);
+	w0 = rtk_1[8]; w1 = rtk_1[9]; w2 = rtk_1[10]; w3 = rtk_1[11];
+	fb = (w2 >> 17) & 0x01;
+	rtk_1[8] = w0 ^ ((w0 ^ w1) & 0x0f0f0f03);
+	rtk_1[11] = w3 ^ ((w3 ^ w0) & 0x0f0f0f03) ^ (fb << 10);
+	rtk_1[9] = w1 & 0x0000000c;
+	rtk_1[9] |= (w2 << 1) & 0x0a0a0a02;
+	rtk_1[9] |= ROR(w2 & 0x00080000, 3);
+	rtk_1[9] |= ROR(w2 & 0x02020000, 7);
+	rtk_1[9] |= ROR(w2 & 0x00000202, 9);
+	rtk_1[9] |= ROR(w2 & 0x00000800, 17);
+	rtk_1[9] |= ROR(w2 & 0x08000000, 19);
+	rtk_1[9] ^= fb << 11;
+	rtk_1[10] = w2 ^ ((w2 ^ w3) & 0x0f0f0f03) ^ (fb << 11);
+	w0 = rtk_1[16]; w1 = rtk_1[17]; w2 = rtk_1[18]; w3 = rtk_1[19];
+	fb = (w2 >> 15) & 0x01;
+	rtk_1[16] = w0 ^ ((w0 ^ w1) & 0xf030f0f0);
+	rtk_1[19] = w3 ^ ((w3 ^ w0) & 0xf030f0f0) ^ (fb << 20);
+	rtk_1[17] = w1 & 0x00c00000;
+	rtk_1[17] |= (w2 << 1) & 0xa020a0a0;
+	rtk_1[17] |= ROR(w2 & 0x80000080, 3);
+	rtk_1[17] |= ROR(w2 & 0x00000020, 7);
+	rtk_1[17] |= ROR(w2 & 0x00200000, 15);
+	rtk_1[17] |= ROR(w2 & 0x20000000, 17);
+	rtk_1[17] |= ROR(w2 & 0x00008000, 27);
+	rtk_1[17] |= ROR(w2 & 0x00002000, 31);
+	rtk_1[17] ^= fb << 21;
+	rtk_1[18] = w2 ^ ((w2 ^ w3) & 0xf030f0f0) ^ (fb << 21);
+	w0 = rtk_1[24]; w1 = rtk_1[25]; w2 = rtk_1[26]; w3 = rtk_1[27];
+	fb = (w2 >> 17) & 0x01;
+	rtk_1[24] = w0 ^ ((w0 ^ w1) & 0x030f0f0f);
+	rtk_1[27] = w3 ^ ((w3 ^ w0) & 0x030f0f0f) ^ (fb << 8);
+	rtk_1[25] = w1 & 0x0c000000;
+	rtk_1[25] |= (w2 << 1) & 0x020a0a0a;
+	rtk_1[25] |= ROR(w2 & 0x00080000, 3);
+	rtk_1[25] |= ROR(w2 & 0x00020800, 9);
+	rtk_1[25] |= ROR(w2 & 0x00000208, 17);
+	rtk_1[25] |= ROR(w2 & 0x00000002, 23);
+	rtk_1[25] |= ROR(w2 & 0x02000000, 25);
+	rtk_1[25] ^= fb << 9;
+	rtk_1[26] = w2 ^ ((w2 ^ w3) & 0x030f0f0f) ^ (fb << 9);
+	w0 = rtk_1[32]; w1 = rtk_1[33]; w2 = rtk_1[34]; w3 = rtk_1[35];
+	fb = (w2 >> 15) & 0x01;
+	rtk_1[32] = w0 ^ ((w0 ^ w1) & 0xf0f0f0c0);
+	rtk_1[35] = w3 ^ ((w3 ^ w0) & 0xf0f0f0c0) ^ (fb << 12);
+	rtk_1[33] = w1 & 0x00000030;
+	rtk_1[33] |= (w2 << 1) & 0xa0a0a080;
+	rtk_1[33] |= ROR(w2 & 0x00008000, 3);
+	rtk_1[33] |= ROR(w2 & 0x80000000, 9);
+	rtk_1[33] |= ROR(w2 & 0x20200000, 23);
+	rtk_1[33] |= ROR(w2 & 0x00002080, 25);
+	rtk_1[33] |= ROR(w2 & 0x00800000, 27);
+	rtk_1[33] ^= fb << 13;
+	rtk_1[34] = w2 ^ ((w2 ^ w3) & 0xf0f0f0c0) ^ (fb << 13);
+	w0 = rtk_1[40]; w1 = rtk_1[41]; w2 = rtk_1[42]; w3 = rtk_1[43];
+	fb = (w2 >> 27) & 0x01;
+	rtk_1[40] = w0 ^ ((w0 ^ w1) & 0x0c0f0f0f);
+	rtk_1[43] = w3 ^ ((w3 ^ w0) & 0x0c0f0f0f) ^ (fb << 18);
+	rtk_1[41] = w1 & 0x03000000;
+	rtk_1[41] |= (w2 << 1) & 0x080a0a0a;
+	rtk_1[41] |= ROR(w2 & 0x00080000, 3);
+	rtk_1[41] |= ROR(w2 & 0x00000200, 7);
+	rtk_1[41] |= ROR(w2 & 0x08000000, 9);
+	rtk_1[41] |= ROR(w2 & 0x00020800, 17);
+	rtk_1[41] |= ROR(w2 & 0x0000000a, 25);
+	rtk_1[41] ^= fb << 19;
+	rtk_1[42] = w2 ^ ((w2 ^ w3) & 0x0c0f0f0f) ^ (fb << 19);
+	w0 = rtk_1[48]; w1 = rtk_1[49]; w2 = rtk_1[50]; w3 = rtk_1[51];
+	fb = (w2 >> 7) & 0x01;
+	rtk_1[48] = w0 ^ ((w0 ^ w1) & 0xc0f0f0f0);
+	rtk_1[51] = w3 ^ ((w3 ^ w0) & 0xc0f0f0f0) ^ (fb << 12);
+	rtk_1[49] = w1 & 0x30000000;
+	rtk_1[49] |= (w2 << 1) & 0x80a0a0a0;
+	rtk_1[49] |= ROR(w2 & 0x00800000, 3);
+	rtk_1[49] |= ROR(w2 & 0x00200020, 15);
+	rtk_1[49] |= ROR(w2 & 0x00008000, 17);
+	rtk_1[49] |= ROR(w2 & 0x80000080, 27);
+	rtk_1[49] |= ROR(w2 & 0x00002000, 31);
+	rtk_1[49] ^= fb << 13;
+	rtk_1[50] = w2 ^ ((w2 ^ w3) & 0xc0f0f0f0) ^ (fb << 13);
+	w0 = rtk_1[56]; w1 = rtk_1[57]; w2 = rtk_1[58]; w3 = rtk_1[59];
+	fb = (w2 >> 25) & 0x01;
+	rtk_1[56] = w0 ^ ((w0 ^ w1) & 0x0f0f0f03);
+	rtk_1[59] = w3 ^ ((w3 ^ w0) & 0x0f0f0f03) ^ (fb << 18);
+	rtk_1[57] = w1 & 0x0000000c;
+	rtk_1[57] |= (w2 << 1) & 0x0a0a0a02;
+	rtk_1[57] |= ROR(w2 & 0x00080000, 3);
+	rtk_1[57] |= ROR(w2 & 0x02020002, 7);
+	rtk_1[57] |= ROR(w2 & 0x00000800, 11);
+	rtk_1[57] |= ROR(w2 & 0x00000200, 17);
+	rtk_1[57] |= ROR(w2 & 0x08000000, 19);
+	rtk_1[57] ^= fb << 19;
+	rtk_1[58] = w2 ^ ((w2 ^ w3) & 0x0f0f0f03) ^ (fb << 19);
+	SKINNY_STATS_END(SKINNY_STATS_TK_UPDATE_1);
+}
+
+/******************************************************************************
+* XOR the difference 'diff' on the domain byte (i.e. the 8th byte of TK1) into
+* RTK1. Only valid when the lower half of TK1 is null, as in Romulus-N/M/T.
+******************************************************************************/
+void tk_domain_1(uint32_t* rtk_1, const uint8_t diff) {
+	// bit position of the domain byte within each of the 8 non-null rtk1
+	const uint8_t pos[8] = {28, 2, 22, 26, 4, 24, 28, 2};
+	uint32_t d[4];
+	d[0] = ((diff >> 1) & 0x01) | (((diff >> 5) & 0x01) << 1);
+	d[1] = (diff & 0x01) | (((diff >> 4) & 0x01) << 1);
+	d[2] = ((diff >> 3) & 0x01) | (((diff >> 7) & 0x01) << 1);
+	d[3] = ((diff >> 2) & 0x01) | (((diff >> 6) & 0x01) << 1);
+	for(int i = 0; i < 8; i++) {
+		rtk_1[i*8]   ^= d[0] << pos[i];
+		rtk_1[i*8+1] ^= d[1] << pos[i];
+		rtk_1[i*8+2] ^= d[2] << pos[i];
+		rtk_1[i*8+3] ^= d[3] << pos[i];
+	}
+}
+
+#else
+/******************************************************************************
+* Pack TK1, the round tweakeys being computed on-the-fly by 'skinny128_384_plus'.
+******************************************************************************/
+void tk_schedule_1(uint32_t* rtk1, const uint8_t* tk1) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_1, 1);
+	packing(rtk1, tk1);
+	SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_1);
 }
 
+/******************************************************************************
+* Update the packed TK1 in place to match the next value of the 56-bit LFSR
+* counter used in Romulus (i.e. equivalent to 'UPDATE_CTR').
+******************************************************************************/
+void tk_update_1(uint32_t* rtk_1) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_TK_UPDATE_1, 1);
+	uint8_t tk1[TWEAKEYBYTES];
+	uint8_t fb;
+	unpacking(tk1, rtk_1);
+	fb = tk1[6] >> 7;
+	for(int i = 6; i > 0; i--)
+		tk1[i] = (tk1[i] << 1) | (tk1[i-1] >> 7);
+	tk1[0] = (tk1[0] << 1) ^ (0x95 & -fb);
+	packing(rtk_1, tk1);
+	SKINNY_STATS_END(SKINNY_STATS_TK_UPDATE_1);
+}
+
+/******************************************************************************
+* XOR the difference 'diff' on the domain byte (i.e. the 8th byte of TK1) into
+* the packed TK1.
+******************************************************************************/
+void tk_domain_1(uint32_t* rtk_1, const uint8_t diff) {
+	uint8_t tk1[TWEAKEYBYTES];
+	unpacking(tk1, rtk_1);
+	tk1[7] ^= diff;
+	packing(rtk_1, tk1);
+}
+
+#endif
+
+#if defined(ROMULUS_PROFILE_SMALL)
+/******************************************************************************
+* Pack TK2 and TK3, the round tweakeys being computed on-the-fly by
+* 'skinny128_384_plus'.
+******************************************************************************/
+void tk_schedule_23(uint32_t* rtk_23, const uint8_t* tk2, const uint8_t * tk3) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_23, 1);
+	packing(rtk_23, tk2);
+	packing(rtk_23+4, tk3);
+	SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_23);
+}
+
+/******************************************************************************
+* Pack TK3 (i.e. 'tk_schedule_23' with a null TK2).
+******************************************************************************/
+void tk_schedule_3(uint32_t* rtk_3, const uint8_t * tk3) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_3, 1);
+	memset(rtk_3, 0x00, 16);
+	packing(rtk_3+4, tk3);
+	SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_3);
+}
+
+#else
 /******************************************************************************
 * Precompute LFSR2(TK2) ^ LFSR3(TK3) ^ rconst.
 ******************************************************************************/
 void tk_schedule_23(uint32_t* rtk_23, const uint8_t* tk2, const uint8_t * tk3) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_23, 1);
 	memset(rtk_23, 0x00, 16*SKINNY128_384_ROUNDS);
 	precompute_lfsr_tk2(rtk_23, tk2, SKINNY128_384_ROUNDS);
 	precompute_lfsr_tk3(rtk_23, tk3, SKINNY128_384_ROUNDS);
@@ -368,29 +572,45 @@ void tk_schedule_23(uint32_t* rtk_23, const uint8_t* tk2, const uint8_t * tk3) {
 		for(int j = 0; j < 4; j++)
 			rtk_23[i*4+j] ^= rconst_32_bs[i*4+j];
 	}
+	SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_23);
 }
 
+/******************************************************************************
+* Precompute LFSR3(TK3) ^ rconst (i.e. 'tk_schedule_23' with a null TK2).
+******************************************************************************/
+void tk_schedule_3(uint32_t* rtk_3, const uint8_t * tk3) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_3, 1);
+	memset(rtk_3, 0x00, 16*SKINNY128_384_ROUNDS);
+	precompute_lfsr_tk3(rtk_3, tk3, SKINNY128_384_ROUNDS);
+	permute_tk(rtk_3, (uint8_t*)(rtk_3+8), SKINNY128_384_ROUNDS);
+	for(int i = 0; i < SKINNY128_384_ROUNDS; i++) {				// add rconsts
+		for(int j = 0; j < 4; j++)
+			rtk_3[i*4+j] ^= rconst_32_bs[i*4+j];
+	}
+	SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_3);
+}
+
+#endif
+
 /******************************************************************************
  * Calculation of round tweakeys related to TK1 and TK3
 ******************************************************************************/
 void tk_schedule_13(
-    uint32_t rtk_1[TKPERMORDER*BLOCKBYTES/4],
-    uint32_t rtk_3[SKINNY128_384_ROUNDS*BLOCKBYTES/4],
+    uint32_t rtk_1[RTK1_WORDS],
+    uint32_t rtk_3[RTK23_WORDS],
     const uint8_t tk_1[TWEAKEYBYTES],
     const uint8_t tk_3[TWEAKEYBYTES])
 {
-	uint8_t tk_2[TWEAKEYBYTES];
-	memset(tk_2, 0x00, TWEAKEYBYTES);
 	tk_schedule_1(rtk_1, tk_1);
-    tk_schedule_23(rtk_3, tk_2, tk_3);
+    tk_schedule_3(rtk_3, tk_3);
 }
 
 /******************************************************************************
  * Calculation of round tweakeys related to TK1, TK2 and TK3 (full TK schedule)
 ******************************************************************************/
 void tk_schedule_123(
-    uint32_t rtk_1[TKPERMORDER*BLOCKBYTES/4],
-    uint32_t rtk_23[SKINNY128_384_ROUNDS*BLOCKBYTES/4],
+    uint32_t rtk_1[RTK1_WORDS],
+    uint32_t rtk_23[RTK23_WORDS],
     const uint8_t tk_1[TWEAKEYBYTES],
     const uint8_t tk_2[TWEAKEYBYTES],
     const uint8_t tk_3[TWEAKEYBYTES])
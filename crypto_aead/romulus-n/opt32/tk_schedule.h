@@ -7,6 +7,28 @@
 #define TWEAKEYBYTES 	16
 #define TKPERMORDER 	16
 
+/******************************************************************************
+* Tweakey storage profiles (speed vs RAM trade-off), selected at compile time:
+* - ROMULUS_PROFILE_FAST: all round tweakeys are precomputed (default).
+* - ROMULUS_PROFILE_BALANCED: TK2/TK3 round tweakeys are precomputed while the
+*   ones related to TK1 are computed on-the-fly, 8 rounds at a time.
+* - ROMULUS_PROFILE_SMALL: all round tweakeys are computed on-the-fly, 8 rounds
+*   at a time, only the packed tweakeys are stored.
+* RTK1_WORDS and RTK23_WORDS give the size (in 32-bit words) of the buffers to
+* be passed to the tweakey schedule functions and to 'skinny128_384_plus'.
+******************************************************************************/
+#if defined(ROMULUS_PROFILE_SMALL)
+#define RTK1_WORDS 		4
+#define RTK23_WORDS 	8
+#elif defined(ROMULUS_PROFILE_BALANCED)
+#define RTK1_WORDS 		4
+#define RTK23_WORDS 	(SKINNY128_384_ROUNDS*BLOCKBYTES/4)
+#else
+#define ROMULUS_PROFILE_FAST
+#define RTK1_WORDS 		(TKPERMORDER*BLOCKBYTES/4)
+#define RTK23_WORDS 	(SKINNY128_384_ROUNDS*BLOCKBYTES/4)
+#endif
+
 #define ROR(x,y) (((x) >> (y)) | ((x) << (32 - (y))))
 
 #define XOR_BLOCKS(x,y) ({ 			\
@@ -34,12 +56,21 @@
 	(x)[2] = ((y) >> 16) & 0xff; 	\
 	(x)[3] = (y) >> 24;
 
+extern uint32_t rconst_32_bs[160];
+
 void packing(uint32_t* out, const uint8_t* in);
 void unpacking(uint8_t* out, uint32_t *in);
+void lfsr2_bs(uint32_t* tk);
+void lfsr3_bs(uint32_t* tk);
+void permute_tk_8rounds(uint32_t* tk, uint32_t* tmp, const uint32_t* tk1,
+	const int test);
 void tk_schedule_1(uint32_t *rtk_1, const uint8_t *tk_1);
+void tk_update_1(uint32_t *rtk_1);
+void tk_domain_1(uint32_t *rtk_1, const uint8_t diff);
 void tk_schedule_13(uint32_t *rtk_1, uint32_t *rtk_3,
     const uint8_t *tk_1,
     const uint8_t *tk_3);
+void tk_schedule_3(uint32_t *rtk_3, const uint8_t *tk_3);
 void tk_schedule_23(uint32_t *rtk_23,
     const uint8_t *tk_2,
     const uint8_t *tk_3);
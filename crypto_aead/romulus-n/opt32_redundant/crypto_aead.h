@@ -0,0 +1 @@
+../opt32/crypto_aead.h
\ No newline at end of file
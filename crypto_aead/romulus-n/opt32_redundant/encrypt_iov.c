@@ -0,0 +1 @@
+../opt32/encrypt_iov.c
\ No newline at end of file
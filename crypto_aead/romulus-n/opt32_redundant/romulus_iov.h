@@ -0,0 +1 @@
+../opt32/romulus_iov.h
\ No newline at end of file
@@ -0,0 +1 @@
+../opt32/romulus_n.c
\ No newline at end of file
@@ -0,0 +1 @@
+../opt32/romulus_n.h
\ No newline at end of file
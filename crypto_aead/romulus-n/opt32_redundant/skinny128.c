@@ -0,0 +1,179 @@
+/******************************************************************************
+* Redundant implementation of Skinny-128-384+ for Romulus, relying on the
+* 2-block fixsliced implementation: the same block is processed in both slots
+* and the outputs are compared in constant time to detect fault injections.
+*
+* Each round tweakey word holds the same tweakey bits for both slots, the bits
+* of slot 0 and slot 1 being interleaved (see 'packing'), so that faults are
+* detected only if they affect the two slots differently:
+* - any single-bit fault on a round tweakey word (or on the state) is detected,
+*   as it only affects one slot;
+* - faults which flip both copies of a bit (i.e. bits 2k and 2k+1 of a round
+*   tweakey word), set a round tweakey word to zero or skip its addition, as
+*   well as faults on the tweakeys, key or input before they are packed (e.g.
+*   on the byte-wise TK1 updated by 'tk_update_1'), remain undetected.
+******************************************************************************/
+#include <string.h>
+#include "skinny128.h"
+#include "skinny_stats.h"
+
+/****************************************************************************
+* The MixColumns operation for rounds i such that (i % 4) == 0
+****************************************************************************/
+void mixcolumns_0(u32* state) {
+	u32 tmp;
+	for(int i = 0; i < 8; i++) {
+		tmp = ROR(state[i],24) & 0x0c0c0c0c;
+		state[i] ^= ROR(tmp,30);
+		tmp = ROR(state[i],16) & 0xc0c0c0c0;
+		state[i] ^= ROR(tmp,4);
+		tmp = ROR(state[i],8) & 0x0c0c0c0c;
+		state[i] ^= ROR(tmp,2);
+	}
+}
+
+/****************************************************************************
+* The MixColumns operation for rounds i such that (i % 4) == 1
+****************************************************************************/
+void mixcolumns_1(u32* state) {
+	u32 tmp;
+	for(int i = 0; i < 8; i++) {
+		tmp = ROR(state[i],16) & 0x30303030;
+		state[i] ^= ROR(tmp,30);
+		tmp = state[i] & 0x03030303;
+		state[i] ^= ROR(tmp,28);
+		tmp = ROR(state[i],16) & 0x30303030;
+		state[i] ^= ROR(tmp,2);
+	}
+}
+
+/****************************************************************************
+* The MixColumns operation for rounds i such that (i % 4) == 2
+****************************************************************************/
+void mixcolumns_2(u32* state) {
+	u32 tmp;
+	for(int i = 0; i < 8; i++) {
+		tmp = ROR(state[i],8) & 0xc0c0c0c0;
+		state[i] ^= ROR(tmp,6);
+		tmp = ROR(state[i],16) & 0x0c0c0c0c;
+		state[i] ^= ROR(tmp,28);
+		tmp = ROR(state[i],24) & 0xc0c0c0c0;
+		state[i] ^= ROR(tmp,2);
+	}
+}
+
+/****************************************************************************
+* The MixColumns operation for rounds i such that (i % 4) == 3
+****************************************************************************/
+void mixcolumns_3(u32* state) {
+	u32 tmp;
+	for(int i = 0; i < 8; i++) {
+		tmp = state[i] & 0x03030303;
+		state[i] ^= ROR(tmp,30);
+		tmp = state[i] & 0x30303030;
+		state[i] ^= ROR(tmp,4);
+		tmp = state[i] & 0x03030303;
+		state[i] ^= ROR(tmp,26);
+	}
+}
+
+/****************************************************************************
+* Adds the round tweakeys (including the round constants) to the state
+****************************************************************************/
+void add_tweakey(u32* state, const u32* rtk1, const u32* rtk2_3) {
+	state[0] ^= rtk1[0] ^ rtk2_3[0];
+	state[1] ^= rtk1[1] ^ rtk2_3[1];
+	state[2] ^= rtk1[2] ^ rtk2_3[2];
+	state[3] ^= rtk1[3] ^ rtk2_3[3];
+	state[4] ^= rtk1[4] ^ rtk2_3[4];
+	state[5] ^= rtk1[5] ^ rtk2_3[5];
+	state[6] ^= rtk1[6] ^ rtk2_3[6];
+	state[7] ^= rtk1[7] ^ rtk2_3[7];
+}
+
+/****************************************************************************
+* Encryption of a single block using Skinny-128-384+, computed twice in
+* parallel. RTK1 and RTK2_3 are given separately to take advantage of the fact
+* that TK2 and TK3 remain the same through the entire data processing.
+* Returns 0xffffffff and wipes the output if both results differ, 0 otherwise.
+****************************************************************************/
+u32 skinny128_384_plus(u8* ctext, const u8* ptext,
+					const u32* rtk1, const u32* rtk2_3) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 1);
+	u32 state[8];
+	u32 fault = 0;
+	u8 ctext_bis[BLOCKBYTES];
+	packing(state, ptext, ptext);
+	QUADRUPLE_ROUND(state, rtk1, 	rtk2_3);
+	QUADRUPLE_ROUND(state, rtk1+32, rtk2_3+32);
+	QUADRUPLE_ROUND(state, rtk1+64, rtk2_3+64);
+	QUADRUPLE_ROUND(state, rtk1+96, rtk2_3+96);
+	QUADRUPLE_ROUND(state, rtk1, 	rtk2_3+128);
+	QUADRUPLE_ROUND(state, rtk1+32, rtk2_3+160);
+	QUADRUPLE_ROUND(state, rtk1+64, rtk2_3+192);
+	QUADRUPLE_ROUND(state, rtk1+96, rtk2_3+224);
+	QUADRUPLE_ROUND(state, rtk1, 	rtk2_3+256);
+	QUADRUPLE_ROUND(state, rtk1+32, rtk2_3+288);
+	unpacking(ctext, ctext_bis, state);
+	for(int i = 0; i < BLOCKBYTES; i++)
+		fault |= ctext[i] ^ ctext_bis[i];
+	fault = 0 - ((fault | (0 - fault)) >> 31); 	// 0xffffffff if fault
+	for(int i = 0; i < BLOCKBYTES; i++)
+		ctext[i] &= ~fault;
+	SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+	return fault;
+}
+
+/****************************************************************************
+* Precompute the TK1 round tweakeys for both slots. Since the permutation has
+* an order of 16, only 16 rounds are stored. TK1 is also kept in byte-wise
+* representation at the end of the buffer so that it can be updated.
+****************************************************************************/
+void tk_schedule_1(u32* rtk_1, const u8* tk_1) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_1, 1);
+	u8* tk1 = (u8*)(rtk_1 + TKPERMORDER*8);
+	memcpy(tk1, tk_1, TWEAKEYBYTES);
+	memset(rtk_1, 0x00, 32*TKPERMORDER);
+	permute_tk(rtk_1, tk1, tk1, TKPERMORDER);
+	SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_1);
+}
+
+/****************************************************************************
+* Update the 56-bit LFSR counter stored in TK1 (i.e. 'UPDATE_CTR') and
+* recompute the TK1 round tweakeys accordingly.
+****************************************************************************/
+void tk_update_1(u32* rtk_1) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_TK_UPDATE_1, 1);
+	u8* tk1 = (u8*)(rtk_1 + TKPERMORDER*8);
+	u8 fb = tk1[6] >> 7;
+	for(int i = 6; i > 0; i--)
+		tk1[i] = (tk1[i] << 1) | (tk1[i-1] >> 7);
+	tk1[0] = (tk1[0] << 1) ^ (0x95 & -fb);
+	memset(rtk_1, 0x00, 32*TKPERMORDER);
+	permute_tk(rtk_1, tk1, tk1, TKPERMORDER);
+	SKINNY_STATS_END(SKINNY_STATS_TK_UPDATE_1);
+}
+
+/****************************************************************************
+* Precompute LFSR2(TK2) ^ LFSR3(TK3) ^ rconst for both slots.
+****************************************************************************/
+void tk_schedule_23(u32* rtk_23, const u8* tk_2, const u8* tk_3) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_23, 1);
+	const u8 zero[TWEAKEYBYTES] = {0x00};
+	memset(rtk_23, 0x00, 32*SKINNY128_384_ROUNDS);
+	precompute_lfsr_tk2(rtk_23, tk_2, tk_2, SKINNY128_384_ROUNDS);
+	precompute_lfsr_tk3(rtk_23, tk_3, tk_3, SKINNY128_384_ROUNDS);
+	permute_tk(rtk_23, zero, zero, SKINNY128_384_ROUNDS);
+	for(int i = 0; i < SKINNY128_384_ROUNDS*8; i++) 	//add all rconsts
+		rtk_23[i] ^= rconst_32_bs[i];
+	SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_23);
+}
+
+/****************************************************************************
+* Calculation of round tweakeys related to TK1, TK2 and TK3 (full TK schedule)
+****************************************************************************/
+void tk_schedule_123(u32* rtk_1, u32* rtk_23, const u8* tk_1,
+					const u8* tk_2, const u8* tk_3) {
+	tk_schedule_1(rtk_1, tk_1);
+	tk_schedule_23(rtk_23, tk_2, tk_3);
+}
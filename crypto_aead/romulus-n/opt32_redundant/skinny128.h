@@ -0,0 +1,102 @@
+#ifndef SKINNY128_H_
+#define SKINNY128_H_
+
+#include "tk_schedule.h"
+
+/******************************************************************************
+* Romulus on top of the 2-block fixsliced Skinny-128-384+: each call computes
+* the same block in both slots and compares the two outputs, so that faults
+* affecting a single slot are detected. Enables the corresponding code paths
+* in the Romulus operating modes.
+******************************************************************************/
+#define ROMULUS_REDUNDANT
+
+#define BLOCKBYTES 				16
+#define TWEAKEYBYTES 			16
+#define TKPERMORDER 			16
+#define SKINNY128_128_ROUNDS	40
+#define SKINNY128_256_ROUNDS	48
+#define SKINNY128_384_ROUNDS	40 		// Skinny-128-384+ as used in Romulus
+
+// 16 rounds of TK1 round tweakeys followed by TK1 in byte-wise representation
+#define RTK1_WORDS 				(TKPERMORDER*8 + TWEAKEYBYTES/4)
+#define RTK23_WORDS 			(SKINNY128_384_ROUNDS*8)
+
+extern u32 rconst_32_bs[448];
+
+void precompute_lfsr_tk2(u32* tk, const u8* tk2_0,
+						const u8* tk2_1, const int rounds);
+void precompute_lfsr_tk3(u32* tk, const u8* tk3_0,
+						const u8* tk3_1, const int rounds);
+void permute_tk(u32* tk, const u8* tk1_0, const u8* tk1_1, const int rounds);
+
+void mixcolumns_0(u32* state);
+void mixcolumns_1(u32* state);
+void mixcolumns_2(u32* state);
+void mixcolumns_3(u32* state);
+void add_tweakey(u32* state, const u32* rtk1, const u32* rtk2_3);
+
+u32 skinny128_384_plus(u8* ctext, const u8* ptext,
+					const u32* rtk1, const u32* rtk2_3);
+void tk_schedule_1(u32* rtk_1, const u8* tk_1);
+void tk_update_1(u32* rtk_1);
+void tk_schedule_23(u32* rtk_23, const u8* tk_2, const u8* tk_3);
+void tk_schedule_123(u32* rtk_1, u32* rtk_23, const u8* tk_1,
+					const u8* tk_2, const u8* tk_3);
+
+#define QUADRUPLE_ROUND(state, rtk1, rtk2_3) ({		\
+	state[3] ^= (state[0] | state[1]);					\
+	state[7] ^= (state[4] | state[5]);					\
+	state[1] ^= (state[6] | state[5]);					\
+	state[2] ^= (state[3] & state[7]);					\
+	state[6] ^= (~state[7] | state[4]);					\
+	state[0] ^= (state[2] | ~state[1]);					\
+	state[4] ^= (~state[3] | state[2]);					\
+	state[5] ^= (state[6] & state[0]);					\
+	add_tweakey(state, rtk1, rtk2_3);					\
+	mixcolumns_0(state);								\
+	state[4] ^= (state[2] | state[3]);					\
+	state[5] ^= (state[6] | state[1]);					\
+	state[3] ^= (state[0] | state[1]);					\
+	state[7] ^= (state[4] & state[5]);					\
+	state[0] ^= (~state[5] | state[6]);					\
+	state[2] ^= (state[7] | ~state[3]);					\
+	state[6] ^= (~state[4] | state[7]);					\
+	state[1] ^= (state[0] & state[2]);					\
+	add_tweakey(state, rtk1+8, rtk2_3+8);				\
+	mixcolumns_1(state);								\
+	state[6] ^= (state[7] | state[4]);					\
+	state[1] ^= (state[0] | state[3]);					\
+	state[4] ^= (state[2] | state[3]);					\
+	state[5] ^= (state[6] & state[1]);					\
+	state[2] ^= (~state[1] | state[0]);					\
+	state[7] ^= (state[5] | ~state[4]);					\
+	state[0] ^= (~state[6] | state[5]);					\
+	state[3] ^= (state[2] & state[7]);					\
+	add_tweakey(state, rtk1+16, rtk2_3+16);				\
+	mixcolumns_2(state);								\
+	state[0] ^= (state[5] | state[6]);					\
+	state[3] ^= (state[2] | state[4]);					\
+	state[6] ^= (state[7] | state[4]);					\
+	state[1] ^= (state[0] & state[3]);					\
+	state[7] ^= (~state[3] | state[2]);					\
+	state[5] ^= (state[1] | ~state[6]);					\
+	state[2] ^= (~state[0] | state[1]);					\
+	state[4] ^= (state[7] & state[5]);					\
+	add_tweakey(state, rtk1+24, rtk2_3+24);				\
+	mixcolumns_3(state);								\
+	state[0] ^= state[1]; 								\
+	state[1] ^= state[0]; 								\
+	state[0] ^= state[1]; 								\
+	state[2] ^= state[3]; 								\
+	state[3] ^= state[2]; 								\
+	state[2] ^= state[3]; 								\
+	state[4] ^= state[7]; 								\
+	state[7] ^= state[4]; 								\
+	state[4] ^= state[7]; 								\
+	state[5] ^= state[6]; 								\
+	state[6] ^= state[5]; 								\
+	state[5] ^= state[6]; 								\
+})
+
+#endif  // SKINNY128_H_
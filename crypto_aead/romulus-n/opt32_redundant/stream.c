@@ -0,0 +1 @@
+../opt32/stream.c
\ No newline at end of file
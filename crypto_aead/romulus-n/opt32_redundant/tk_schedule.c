@@ -0,0 +1 @@
+../../../crypto_tbc/skinny128/bitsliced/2_blocks/opt32/tk_schedule.c
\ No newline at end of file
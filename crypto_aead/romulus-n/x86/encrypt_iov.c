@@ -0,0 +1,209 @@
+/**
+ * Romulus-N scatter-gather (iovec) interface.
+ * 
+ * Same processing as in 'romulus_n.c', except that the additional data and
+ * message blocks are fetched through fragment cursors (see 'romulus_iov.h').
+ * Runs of full message blocks lying within a single input fragment and a
+ * single output fragment are handed over to 'skinny128_384_plus_rho' at once.
+ * 
+ * @date        October 2026
+ */
+#include "romulus_n.h"
+#include "romulus_iov.h"
+#include "skinny_stats.h"
+
+/**
+ * Process the additional data fragments and updates the internal state
+ * accordingly (see 'romulusn_process_ad').
+ */
+static void romulusn_process_ad_iov(
+    uint8_t *state, const struct iovec *ad, int adcnt,
+    uint8_t *rtk_23, uint8_t *tk1, const uint8_t *npub, const uint8_t *k)
+{
+    int i;
+    uint32_t tmp;
+    uint8_t buf[BLOCKBYTES];
+    uint8_t pad[BLOCKBYTES];
+    const uint8_t *blk;
+    iov_cursor cur;
+    unsigned long long adlen = iov_total(ad, adcnt);
+    iov_init(&cur, ad, adcnt);
+    if (adlen == 0) {
+        UPDATE_CTR(tk1);
+        SET_DOMAIN(tk1, 0x1A);
+        tk_schedule_23(rtk_23, npub, k);
+        skinny128_384_plus(state, state, tk1, rtk_23);
+    } else {    // Process all double blocks except the last
+        SET_DOMAIN(tk1, 0x08);
+        while (adlen > 2*BLOCKBYTES) {
+            UPDATE_CTR(tk1);
+            blk = iov_block(&cur, buf, BLOCKBYTES);
+            XOR_BLOCK(state, state, blk);
+            blk = iov_block(&cur, buf, BLOCKBYTES);
+            tk_schedule_23(rtk_23, blk, k);
+            skinny128_384_plus(state, state, tk1, rtk_23);
+            UPDATE_CTR(tk1);
+            adlen -= 2*BLOCKBYTES;
+        }
+        //Pad and process the left-over blocks 
+        UPDATE_CTR(tk1);
+        if (adlen == 2*BLOCKBYTES) {        // Left-over complete double block
+            blk = iov_block(&cur, buf, BLOCKBYTES);
+            XOR_BLOCK(state, state, blk);
+            blk = iov_block(&cur, buf, BLOCKBYTES);
+            tk_schedule_23(rtk_23, blk, k);
+            skinny128_384_plus(state, state, tk1, rtk_23);
+            UPDATE_CTR(tk1);
+            SET_DOMAIN(tk1, 0x18);
+        } else if (adlen > BLOCKBYTES) {    //  Left-over partial double block
+            adlen -= BLOCKBYTES;
+            blk = iov_block(&cur, buf, BLOCKBYTES);
+            XOR_BLOCK(state, state, blk);
+            iov_read(&cur, pad, adlen);
+            zeroize(pad + adlen, 15 - adlen);
+            pad[15] = adlen;
+            tk_schedule_23(rtk_23, pad, k);
+            skinny128_384_plus(state, state, tk1, rtk_23);
+            UPDATE_CTR(tk1);
+            SET_DOMAIN(tk1, 0x1A);
+        } else if (adlen == BLOCKBYTES) {   //  Left-over complete single block 
+            blk = iov_block(&cur, buf, BLOCKBYTES);
+            XOR_BLOCK(state, state, blk);
+            SET_DOMAIN(tk1, 0x18);
+        } else {    // Left-over partial single block
+            iov_read(&cur, pad, adlen);
+            for(i = 0; i < (int)adlen; i++)
+                state[i] ^= pad[i];
+            state[15] ^= adlen;
+            SET_DOMAIN(tk1, 0x1A);
+        }
+        tk_schedule_23(rtk_23, npub, k);
+        skinny128_384_plus(state, state, tk1, rtk_23);
+    }
+}
+
+/**
+ * Process the 'inlen' bytes of the input fragments and updates the internal
+ * state as well as the output fragments accordingly (see
+ * 'romulusn_process_msg').
+ */
+static void romulusn_process_msg_iov(
+    const struct iovec *out, int outcnt,
+    const struct iovec *in, int incnt, unsigned long long inlen,
+    uint8_t *state, const uint8_t *rtk_23, uint8_t *tk1, const int mode)
+{
+    int i;
+    uint32_t tmp;
+    uint8_t tmp_blk[BLOCKBYTES];
+    uint8_t in_blk[BLOCKBYTES];
+    uint8_t out_blk[BLOCKBYTES];
+    unsigned long long nblocks, run;
+    size_t in_contig, out_contig;
+    iov_cursor in_cur, out_cur;
+    iov_init(&in_cur, in, incnt);
+    iov_init(&out_cur, out, outcnt);
+    zeroize(tk1, TWEAKEYBYTES);
+    tk1[0] = 0x01;          //init the 56-bit LFSR counter
+    if (inlen == 0) {
+        UPDATE_CTR(tk1);
+        SET_DOMAIN(tk1, 0x15);
+        skinny128_384_plus(state, state, tk1, rtk_23);
+    } else {        //process all blocks except the last
+        SET_DOMAIN(tk1, 0x04);
+        nblocks = (inlen - 1) / BLOCKBYTES;
+        inlen -= nblocks*BLOCKBYTES;
+        while (nblocks > 0) {
+            in_contig = iov_contig(&in_cur);
+            out_contig = iov_contig(&out_cur);
+            run = ((in_contig < out_contig) ? in_contig : out_contig) / BLOCKBYTES;
+            run = (run < nblocks) ? run : nblocks;
+            if (run > 0) {      // blocks within a single fragment
+                skinny128_384_plus_rho(state, iov_ptr(&out_cur),
+                    iov_ptr(&in_cur), run, tk1, rtk_23, mode);
+                iov_skip(&in_cur, run*BLOCKBYTES);
+                iov_skip(&out_cur, run*BLOCKBYTES);
+            } else {            // block straddling fragment boundaries
+                run = 1;
+                iov_read(&in_cur, in_blk, BLOCKBYTES);
+                skinny128_384_plus_rho(state, out_blk, in_blk, run, tk1,
+                    rtk_23, mode);
+                iov_write(&out_cur, out_blk, BLOCKBYTES);
+            }
+            nblocks -= run;
+        }
+        // (eventually pad) and process the last block
+        UPDATE_CTR(tk1);
+        iov_read(&in_cur, in_blk, inlen);
+        if (inlen < BLOCKBYTES) {
+            for(i = 0; i < (int)inlen; i++) {
+                out_blk[i] = in_blk[i] ^ (state[i] >> 1) ^ (state[i] & 0x80) ^ (state[i] << 7);
+                state[i] ^= (mode == ENCRYPT_MODE) ? in_blk[i] : out_blk[i];
+            }
+            state[15] ^= (uint8_t)inlen; //padding
+            SET_DOMAIN(tk1, 0x15);
+        } else {
+            if(mode == ENCRYPT_MODE)
+                RHO(state, out_blk, in_blk, tmp_blk);
+            else
+                RHO_INV(state, in_blk, out_blk, tmp_blk);
+            SET_DOMAIN(tk1, 0x14);
+        }
+        iov_write(&out_cur, out_blk, inlen);
+        skinny128_384_plus(state, state, tk1, rtk_23);
+    }
+}
+
+//Encryption and authentication using Romulus-N over fragmented buffers
+int romulusn_encrypt_iov(
+    const struct iovec *ad, int adcnt,
+    const struct iovec *in, int incnt,
+    const struct iovec *out, int outcnt,
+    unsigned char *tag,
+    const unsigned char *npub,
+    const unsigned char *k)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_ENCRYPT, 1);
+    uint8_t state[BLOCKBYTES];
+    uint8_t tk1[TWEAKEYBYTES];
+    uint8_t rtk_23[SKINNY128_384_ROUNDS*BLOCKBYTES/2];
+    unsigned long long inlen = iov_total(in, incnt);
+    if (iov_total(out, outcnt) < inlen)
+        return -1;
+    romulusn_init(state, tk1);
+    romulusn_process_ad_iov(state, ad, adcnt, rtk_23, tk1, npub, k);
+    romulusn_process_msg_iov(out, outcnt, in, incnt, inlen, state, rtk_23,
+        tk1, ENCRYPT_MODE);
+    zeroize(rtk_23, SKINNY128_384_ROUNDS*BLOCKBYTES/2);
+    romulusn_generate_tag(tag, state);
+    SKINNY_STATS_END(SKINNY_STATS_ENCRYPT);
+    return 0;
+}
+
+//Decryption and tag verification using Romulus-N over fragmented buffers
+int romulusn_decrypt_iov(
+    const struct iovec *ad, int adcnt,
+    const struct iovec *in, int incnt,
+    const struct iovec *out, int outcnt,
+    const unsigned char *tag,
+    const unsigned char *npub,
+    const unsigned char *k)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_DECRYPT, 1);
+    uint8_t state[BLOCKBYTES];
+    uint8_t tk1[TWEAKEYBYTES];
+    uint8_t rtk_23[SKINNY128_384_ROUNDS*BLOCKBYTES/2];
+    unsigned long long inlen = iov_total(in, incnt);
+    if (iov_total(out, outcnt) < inlen)
+        return -1;
+    romulusn_init(state, tk1);
+    romulusn_process_ad_iov(state, ad, adcnt, rtk_23, tk1, npub, k);
+    romulusn_process_msg_iov(out, outcnt, in, incnt, inlen, state, rtk_23,
+        tk1, DECRYPT_MODE);
+    zeroize(rtk_23, SKINNY128_384_ROUNDS*BLOCKBYTES/2);
+    SKINNY_STATS_END(SKINNY_STATS_DECRYPT);
+    if (romulusn_verify_tag(tag, state)) {  // unverified plaintext is never released
+        iov_zeroize(out, outcnt, inlen);
+        return -1;
+    }
+    return 0;
+}
@@ -1 +0,0 @@
-../armv8a/precalculate/romulus_n.c
\ No newline at end of file
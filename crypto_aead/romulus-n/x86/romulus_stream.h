@@ -0,0 +1 @@
+../opt32/romulus_stream.h
\ No newline at end of file
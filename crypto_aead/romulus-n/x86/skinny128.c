@@ -9,6 +9,7 @@
  *****************************************************************************/
 #include "immintrin.h"
 #include "skinny128.h"
+#include "skinny_stats.h"
 
 /**
  * Apply the S-box, Add Round Tweakey, and Add Round Constants to the internal
@@ -80,6 +81,31 @@
     SBOX_ARK_ODD(rtk_23+8);     \
     SR_MC();                    \
 
+/**
+ * Apply the 40 rounds of Skinny-128-384+ to the internal state 'state'.
+ */
+#define SKINNY128_384_PLUS_ROUNDS(rtk_23)       \
+    DOUBLE_ROUND(rtk_23);                       \
+    DOUBLE_ROUND(rtk_23+16);                    \
+    DOUBLE_ROUND(rtk_23+32);                    \
+    DOUBLE_ROUND(rtk_23+48);                    \
+    DOUBLE_ROUND(rtk_23+64);                    \
+    DOUBLE_ROUND(rtk_23+80);                    \
+    DOUBLE_ROUND(rtk_23+96);                    \
+    DOUBLE_ROUND(rtk_23+112);                   \
+    DOUBLE_ROUND(rtk_23+128);                   \
+    DOUBLE_ROUND(rtk_23+144);                   \
+    DOUBLE_ROUND(rtk_23+160);                   \
+    DOUBLE_ROUND(rtk_23+176);                   \
+    DOUBLE_ROUND(rtk_23+192);                   \
+    DOUBLE_ROUND(rtk_23+208);                   \
+    DOUBLE_ROUND(rtk_23+224);                   \
+    DOUBLE_ROUND(rtk_23+240);                   \
+    DOUBLE_ROUND(rtk_23+256);                   \
+    DOUBLE_ROUND(rtk_23+272);                   \
+    DOUBLE_ROUND(rtk_23+288);                   \
+    DOUBLE_ROUND(rtk_23+304);                   \
+
 /**
  * Skinny-128-384+ encryption of a single 128-bit block w/o any operation mode.
  * 
@@ -93,6 +119,7 @@ void skinny128_384_plus(
     const unsigned char *tk1,
     const unsigned char *rtk_23)
 {
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 1);
     // use 16 XMM registers to avoid stack usage
     __m128i tmp0;
     __m128i tmp1;
@@ -112,29 +139,170 @@ void skinny128_384_plus(
     __m128i perm_tk  = {0x0304060205000701, 0x0f0e0d0c0b0a0908};
 
     // skinny-128-384+ has 40 rounds
-    DOUBLE_ROUND(rtk_23);
-    DOUBLE_ROUND(rtk_23+16);
-    DOUBLE_ROUND(rtk_23+32);
-    DOUBLE_ROUND(rtk_23+48);
-    DOUBLE_ROUND(rtk_23+64);
-    DOUBLE_ROUND(rtk_23+80);
-    DOUBLE_ROUND(rtk_23+96);
-    DOUBLE_ROUND(rtk_23+112);
-    DOUBLE_ROUND(rtk_23+128);
-    DOUBLE_ROUND(rtk_23+144);
-    DOUBLE_ROUND(rtk_23+160);
-    DOUBLE_ROUND(rtk_23+176);
-    DOUBLE_ROUND(rtk_23+192);
-    DOUBLE_ROUND(rtk_23+208);
-    DOUBLE_ROUND(rtk_23+224);
-    DOUBLE_ROUND(rtk_23+240);
-    DOUBLE_ROUND(rtk_23+256);
-    DOUBLE_ROUND(rtk_23+272);
-    DOUBLE_ROUND(rtk_23+288);
-    DOUBLE_ROUND(rtk_23+304);
+    SKINNY128_384_PLUS_ROUNDS(rtk_23);
 
     // put internal state into output buffer
     _mm_storeu_si128((__m128i*)out, state);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+
+/**
+ * Apply 2 rounds of Skinny-128-384+ to two independent internal states
+ * 'state_0' and 'state_1'. Both instances are processed alternately so that the
+ * out-of-order engine can overlap the two dependency chains.
+ */
+#define DOUBLE_ROUND_X2(rtk_23_0, rtk_23_1)                                     \
+    state = state_0;                                                            \
+    rtk_1 = rtk_1_0;                                                            \
+    DOUBLE_ROUND(rtk_23_0);                                                     \
+    state_0 = state;                                                            \
+    rtk_1_0 = rtk_1;                                                            \
+    state = state_1;                                                            \
+    rtk_1 = rtk_1_1;                                                            \
+    DOUBLE_ROUND(rtk_23_1);                                                     \
+    state_1 = state;                                                            \
+    rtk_1_1 = rtk_1;                                                            \
+
+/**
+ * Skinny-128-384+ encryption of two independent 128-bit blocks w/o any
+ * operation mode, each one with its own tweakey (e.g. two different chains of
+ * a Romulus operating mode).
+ * 
+ * Same as two calls to 'skinny128_384_plus' but both computations are
+ * interleaved to increase the instruction-level parallelism.
+ * 
+ * Unlike the generic 'skinny128_384_plus_x2' of 'crypto_tbc/skinny128/simd/x86'
+ * (which precomputes and adds the full TK1 at every round), this one reuses the
+ * rounds above and thus assumes that the lower half of both TK1 is null, as in
+ * Romulus-N/M. The generic one cannot be linked here anyway since both files
+ * define 'skinny128_384_plus' and 'tk_schedule_23'.
+ */
+void skinny128_384_plus_x2(
+    unsigned char *out_0,
+    const unsigned char *in_0,
+    const unsigned char *tk1_0,
+    const unsigned char *rtk_23_0,
+    unsigned char *out_1,
+    const unsigned char *in_1,
+    const unsigned char *tk1_1,
+    const unsigned char *rtk_23_1)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 2);
+    int i;
+    __m128i tmp0;
+    __m128i tmp1;
+    __m128i rtk;
+    __m128i state;
+    __m128i rtk_1;
+    __m128i state_0 = _mm_loadu_si128((const __m128i*)in_0);
+    __m128i state_1 = _mm_loadu_si128((const __m128i*)in_1);
+    __m128i rtk_1_0 = _mm_loadu_si128((const __m128i*)tk1_0);
+    __m128i rtk_1_1 = _mm_loadu_si128((const __m128i*)tk1_1);
+    __m128i s0 = {0xb090a08010300020, 0xb898a88838182808};
+    __m128i s1 = {0x45044405004181c0, 0x470746064303c282};
+    __m128i s2 = {0x1810080019110901, 0x1a130a031b120b02};
+    __m128i s3 = {0xe063a033c0431380, 0xe464a434c4441484};
+    __m128i m0 = {0x030201000c0f0e0d, 0x09080b0a06050407};
+    __m128i m1 = {0x8080808009080b0a, 0x0302010009080b0a};
+    __m128i c2 = {0x0000000000000000,0x0000000000000002};
+    __m128i mask_row = {0x00000000ffffffff, 0x0000000000000000};
+    __m128i mask_nib = {0x0f0f0f0f0f0f0f0f, 0x0f0f0f0f0f0f0f0f};
+    __m128i mask_lsb = {0x0101010101010101, 0x0101010101010101};
+    __m128i perm_tk  = {0x0304060205000701, 0x0f0e0d0c0b0a0908};
+
+    // skinny-128-384+ has 40 rounds, i.e. 20 double rounds
+    for(i = 0; i < SKINNY128_384_ROUNDS*8; i += 16) {
+        DOUBLE_ROUND_X2(rtk_23_0 + i, rtk_23_1 + i);
+    }
+
+    // put internal states into output buffers
+    _mm_storeu_si128((__m128i*)out_0, state_0);
+    _mm_storeu_si128((__m128i*)out_1, state_1);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+
+/**
+ * Apply the Rho function (or its inverse if 'mode' is non-null) as defined in
+ * the Romulus specification to the internal state 'state' and a single block.
+ * G is computed byte-wise as (x >> 1) ^ ((x ^ (x << 7)) & 0x80).
+ */
+#define RHO_SIMD(out, in, mode)                                                 \
+    blk   = _mm_loadu_si128((const __m128i*)(in));                              \
+    tmp0  = _mm_srli_epi16(state, 1);       /* (x >> 1) (1/2) */                \
+    tmp1  = _mm_slli_epi16(state, 7);       /* (x << 7) */                      \
+    tmp0  = _mm_andnot_si128(mask_msb, tmp0); /* (x >> 1) (2/2) */              \
+    tmp1  = _mm_xor_si128(tmp1, state);     /* x ^ (x << 7) */                  \
+    tmp1  = _mm_and_si128(tmp1, mask_msb);  /* keep the MSB only */             \
+    tmp0  = _mm_xor_si128(tmp0, tmp1);      /* G(state) */                      \
+    tmp0  = _mm_xor_si128(tmp0, blk);       /* G(state) ^ in */                 \
+    blk   = (mode) ? tmp0 : blk;            /* plaintext block */               \
+    state = _mm_xor_si128(state, blk);      /* update the internal state */     \
+    _mm_storeu_si128((__m128i*)(out), tmp0);                                    \
+
+/**
+ * Update the 56-bit LFSR counter of TK1 (bytes 0..6, byte 7 is the domain).
+ * The counter is kept in a general-purpose register and the polynomial
+ * reduction is computed w/o any secret-dependent branch.
+ */
+#define UPDATE_CTR_64(ctr)                                                      \
+    ctr = (((ctr) << 1) & 0x00ffffffffffffffULL) ^                              \
+        (0x95 & (0ULL - (((ctr) >> 55) & 0x01))) ^                              \
+        ((ctr) & 0xff00000000000000ULL);                                        \
+
+/**
+ * Process 'nblocks' full 128-bit blocks of a Romulus-N/M message, i.e. for
+ * each block apply Rho (or its inverse), update the counter in TK1 and call
+ * Skinny-128-384+ on the internal state.
+ *
+ * Contrary to successive calls to 'skinny128_384_plus', the internal state,
+ * the TK1 counter and all the constants are kept in registers during the whole
+ * message processing. The internal state and TK1 are written back at the end.
+ */
+void skinny128_384_plus_rho(
+    unsigned char *state_buf,
+    unsigned char *out,
+    const unsigned char *in,
+    unsigned long long nblocks,
+    unsigned char *tk1,
+    const unsigned char *rtk_23,
+    const int mode)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, nblocks);
+    uint64_t ctr;
+    __m128i tmp0;
+    __m128i tmp1;
+    __m128i rtk;
+    __m128i blk;
+    __m128i rtk_1;
+    __m128i state = _mm_loadu_si128((const __m128i*)state_buf);
+    __m128i s0 = {0xb090a08010300020, 0xb898a88838182808};
+    __m128i s1 = {0x45044405004181c0, 0x470746064303c282};
+    __m128i s2 = {0x1810080019110901, 0x1a130a031b120b02};
+    __m128i s3 = {0xe063a033c0431380, 0xe464a434c4441484};
+    __m128i m0 = {0x030201000c0f0e0d, 0x09080b0a06050407};
+    __m128i m1 = {0x8080808009080b0a, 0x0302010009080b0a};
+    __m128i c2 = {0x0000000000000000,0x0000000000000002};
+    __m128i mask_row = {0x00000000ffffffff, 0x0000000000000000};
+    __m128i mask_nib = {0x0f0f0f0f0f0f0f0f, 0x0f0f0f0f0f0f0f0f};
+    __m128i mask_lsb = {0x0101010101010101, 0x0101010101010101};
+    __m128i mask_msb = {0x8080808080808080, 0x8080808080808080};
+    __m128i perm_tk  = {0x0304060205000701, 0x0f0e0d0c0b0a0908};
+
+    // upper half of TK1 is null for Romulus-N/M
+    ctr = (uint64_t)_mm_cvtsi128_si64(_mm_loadl_epi64((const __m128i*)tk1));
+    while (nblocks--) {
+        RHO_SIMD(out, in, mode);
+        UPDATE_CTR_64(ctr);
+        rtk_1 = _mm_set_epi64x(0, (long long)ctr);
+        SKINNY128_384_PLUS_ROUNDS(rtk_23);
+        out += BLOCKBYTES;
+        in  += BLOCKBYTES;
+    }
+
+    // put internal state and TK1 back into memory
+    _mm_storeu_si128((__m128i*)state_buf, state);
+    _mm_storel_epi64((__m128i*)tk1, _mm_set_epi64x(0, (long long)ctr));
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
 }
 
 /**
@@ -197,6 +365,7 @@ void tk_schedule_23(
     const unsigned char *tk2,
     const unsigned char *tk3)
 {
+    SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_23, 1);
     __m128i rconst;
     __m128i tmp0;
     __m128i tmp1;
@@ -258,4 +427,5 @@ void tk_schedule_23(
     tmp0    = _mm_xor_si128(tmp0, rtk_3);
     tmp0    = _mm_xor_si128(tmp0, rtk_2);
     _mm_storeu_si64((__m128i*)rtk_23, tmp0);
+    SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_23);
 }
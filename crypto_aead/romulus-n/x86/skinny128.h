@@ -1 +0,0 @@
-../../../crypto_tbc/skinny128/simd/x86/skinny128.h
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include <stdint.h>
+
+#define BLOCKBYTES 				16
+#define TWEAKEYBYTES 			16
+#define SKINNY128_384_ROUNDS	40
+
+/**
+ * Skinny-128-384+ simple (i.e. without operating mode) encryption function.
+ * The tweakey schedule for TK1 is computed on-the-fly while it is assumed to
+ * be precomputed for TK2 and TK3.
+ */
+void skinny128_384_plus(
+	uint8_t in[BLOCKBYTES], const uint8_t out[BLOCKBYTES],
+	const uint8_t tk1[TWEAKEYBYTES],
+	const uint8_t rtk_23[SKINNY128_384_ROUNDS*BLOCKBYTES/2]);
+
+/**
+ * Two independent Skinny-128-384+ encryptions computed in an interleaved way
+ * (e.g. to run two chains of a Romulus operating mode in parallel). As for
+ * 'skinny128_384_plus', the lower half of both TK1 is assumed to be null.
+ */
+void skinny128_384_plus_x2(
+	uint8_t out_0[BLOCKBYTES], const uint8_t in_0[BLOCKBYTES],
+	const uint8_t tk1_0[TWEAKEYBYTES],
+	const uint8_t rtk_23_0[SKINNY128_384_ROUNDS*BLOCKBYTES/2],
+	uint8_t out_1[BLOCKBYTES], const uint8_t in_1[BLOCKBYTES],
+	const uint8_t tk1_1[TWEAKEYBYTES],
+	const uint8_t rtk_23_1[SKINNY128_384_ROUNDS*BLOCKBYTES/2]);
+
+/**
+ * Romulus-N/M message processing of 'nblocks' full blocks: for each block,
+ * Rho (or Rho inverse if 'mode' is non-null) followed by a TK1 counter update
+ * and a Skinny-128-384+ call. State, TK1 and constants remain in registers
+ * across all blocks.
+ */
+void skinny128_384_plus_rho(
+	uint8_t state[BLOCKBYTES], uint8_t *out, const uint8_t *in,
+	unsigned long long nblocks, uint8_t tk1[TWEAKEYBYTES],
+	const uint8_t rtk_23[SKINNY128_384_ROUNDS*BLOCKBYTES/2],
+	const int mode);
+
+/**
+ * Precomputation of round tweakeys for TK2 and TK3 (also include a part of the
+ * round constants).
+ */			
+void tk_schedule_23(
+	uint8_t rtk_23[SKINNY128_384_ROUNDS*BLOCKBYTES/2],
+	const uint8_t tk2[TWEAKEYBYTES],
+	const uint8_t tk3[TWEAKEYBYTES]);
+
@@ -56,6 +56,8 @@
     XOR_BLOCK(x, x, z);             \
 })
 
+void zeroize(uint8_t buf[], unsigned long long buflen);
+
 // Core Romulus-T functions
 void romulust_init(uint8_t *state, uint8_t *tk1);
 
@@ -92,4 +94,23 @@ void romulust_generate_tag(
     const unsigned char npub[],
     const unsigned char k[]);
 
+// Detached-tag interface: the tag is written to/read from its own buffer and
+// the output buffer may be the input one (in-place operation).
+// If the tag verification fails, decryption returns -1 and zeroizes the 'clen'
+// bytes of 'm', so that no unverified plaintext is released (in place, the
+// ciphertext is lost as well).
+// 'crypto_aead_encrypt' and 'crypto_aead_decrypt' are wrappers around them.
+int romulust_encrypt_detached(
+    unsigned char *c, unsigned char *tag,
+    const unsigned char *m, unsigned long long mlen,
+    const unsigned char *ad, unsigned long long adlen,
+    const unsigned char *npub, const unsigned char *k);
+
+int romulust_decrypt_detached(
+    unsigned char *m,
+    const unsigned char *c, unsigned long long clen,
+    const unsigned char *tag,
+    const unsigned char *ad, unsigned long long adlen,
+    const unsigned char *npub, const unsigned char *k);
+
 #endif  // ROMULUS_H_
\ No newline at end of file
@@ -8,8 +8,28 @@
  */
 #include "romulus_t.h"
 #include "crypto_aead.h"
+#include "skinny_stats.h"
 
-//Encryption and authentication using Romulus-T
+//Encryption and authentication using Romulus-T with a detached tag ('c' may be 'm')
+int romulust_encrypt_detached(
+  unsigned char *c, unsigned char *tag,
+  const unsigned char *m, unsigned long long mlen,
+  const unsigned char *ad, unsigned long long adlen,
+  const unsigned char *npub,
+  const unsigned char *k)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_ENCRYPT, 1);
+    uint8_t tk1[BLOCKBYTES];
+    uint8_t state[BLOCKBYTES];
+    romulust_init(state, tk1);
+    romulust_kdf(state, tk1, npub, k);
+    romulust_process_msg(state, tk1, npub, c, m, mlen);
+    romulust_generate_tag(tag, tk1, ad, adlen, c, mlen, npub, k);
+    SKINNY_STATS_END(SKINNY_STATS_ENCRYPT);
+    return 0;
+}
+
+//Encryption and authentication using Romulus-T following the SUPERCOP API
 int crypto_aead_encrypt(
   unsigned char *c, unsigned long long *clen,
   const unsigned char *m, unsigned long long mlen,
@@ -19,17 +39,40 @@ int crypto_aead_encrypt(
   const unsigned char *k)
 {
     (void)nsec;
+    *clen = mlen + TAGBYTES;
+    return romulust_encrypt_detached(c, c + mlen, m, mlen, ad, adlen, npub, k);
+}
+
+//Decryption and tag verification using Romulus-T with a detached tag ('m' may be 'c')
+int romulust_decrypt_detached(
+  unsigned char *m,
+  const unsigned char *c, unsigned long long clen,
+  const unsigned char *tag,
+  const unsigned char *ad, unsigned long long adlen,
+  const unsigned char *npub,
+  const unsigned char *k)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_DECRYPT, 1);
     uint8_t tk1[BLOCKBYTES];
     uint8_t state[BLOCKBYTES];
-    *clen = mlen + TAGBYTES;
+    uint8_t tmp = 0x00;
+    // tag verification
+    romulust_generate_tag(state, tk1, ad, adlen, c, clen, npub, k);
+    for(int i = 0; i < TAGBYTES; i++)
+        tmp |= state[i] ^ tag[i];   //constant-time tag comparison
+    if (tmp) {      // unverified plaintext is never released
+        zeroize(m, clen);
+        return -1;
+    }
+    // decryption
     romulust_init(state, tk1);
     romulust_kdf(state, tk1, npub, k);
-    romulust_process_msg(state, tk1, npub, c, m, mlen);
-    romulust_generate_tag(c+mlen, tk1, ad, adlen, c, mlen, npub, k);
+    romulust_process_msg(state, tk1, npub, m, c, clen);
+    SKINNY_STATS_END(SKINNY_STATS_DECRYPT);
     return 0;
 }
 
-//Encryption and authentication using Romulus-T
+//Decryption and tag verification using Romulus-T following the SUPERCOP API
 int crypto_aead_decrypt(
   unsigned char *m, unsigned long long *mlen,
   unsigned char *nsec,
@@ -39,21 +82,8 @@ int crypto_aead_decrypt(
   const unsigned char *k)
 {
     (void)nsec;
-    uint8_t tk1[BLOCKBYTES];
-    uint8_t state[BLOCKBYTES];
-    uint8_t tmp = 0x00;
-    // tag verification
     if (clen < TAGBYTES)
       return -1;
     *mlen = clen - TAGBYTES;
-    romulust_generate_tag(state, tk1, ad, adlen, c, *mlen, npub, k);
-    for(int i = 0; i < TAGBYTES; i++)
-        tmp |= state[i] ^ c[clen-TAGBYTES+i];   //constant-time tag comparison
-    if (tmp)
-      return -1;
-    // decryption
-    romulust_init(state, tk1);
-    romulust_kdf(state, tk1, npub, k);
-    romulust_process_msg(state, tk1, npub, m, c, *mlen);
-    return 0;
+    return romulust_decrypt_detached(m, c, *mlen, c + *mlen, ad, adlen, npub, k);
 }
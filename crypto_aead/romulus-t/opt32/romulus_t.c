@@ -13,9 +13,9 @@
 /**
  * Equivalent to 'memset(buf, 0x00, buflen)'.
  */
-static void zeroize(uint8_t buf[], int buflen)
+void zeroize(uint8_t buf[], unsigned long long buflen)
 {
-  int i;
+  unsigned long long i;
   for(i = 0; i < buflen; i++)
     buf[i] = 0x00;
 }
@@ -30,8 +30,8 @@ static void hirose_128_128_256(
 {
   uint8_t i;
   uint8_t tmp[BLOCKBYTES];
-  uint32_t rtk_1[TKPERMORDER*BLOCKBYTES/4];
-  uint32_t rtk_23[SKINNY128_384_ROUNDS*BLOCKBYTES/4];
+  uint32_t rtk_1[RTK1_WORDS];
+  uint32_t rtk_23[RTK23_WORDS];
 
   tk_schedule_123(rtk_1, rtk_23, g, m, m+BLOCKBYTES);
   skinny128_384_plus(tmp, h, rtk_1, rtk_23);
@@ -235,8 +235,8 @@ void romulust_kdf(
   const unsigned char *npub,
   const unsigned char *k)
 {
-  uint32_t rtk_1[TKPERMORDER*BLOCKBYTES/4];
-  uint32_t rtk_3[SKINNY128_384_ROUNDS*BLOCKBYTES/4];
+  uint32_t rtk_1[RTK1_WORDS];
+  uint32_t rtk_3[RTK23_WORDS];
 	SET_DOMAIN(tk1, 0x42);
   tk_schedule_13(rtk_1, rtk_3, tk1, k);
 	skinny128_384_plus(state, npub, rtk_1, rtk_3);
@@ -259,23 +259,26 @@ void romulust_process_msg(
   uint32_t tmp;
   unsigned long long i;
 	uint8_t out[BLOCKBYTES];
-  uint32_t rtk_1[TKPERMORDER*BLOCKBYTES/4];
-  uint32_t rtk_3[SKINNY128_384_ROUNDS*BLOCKBYTES/4];
+  uint32_t rtk_1[RTK1_WORDS];
+  uint32_t rtk_3[RTK23_WORDS];
+  SET_DOMAIN(tk1, 0x40);
+  tk_schedule_1(rtk_1, tk1);
 	while(mlen > BLOCKBYTES) {
-		SET_DOMAIN(tk1, 0x40);
-    tk_schedule_13(rtk_1, rtk_3, tk1, state);
+    tk_schedule_3(rtk_3, state);
     skinny128_384_plus(out, npub, rtk_1, rtk_3);
 		SET_DOMAIN(tk1, 0x41);
-    tk_schedule_1(rtk_1, tk1);
+    tk_domain_1(rtk_1, 0x40 ^ 0x41);
     skinny128_384_plus(state, npub, rtk_1, rtk_3);
+		SET_DOMAIN(tk1, 0x40);
+    tk_domain_1(rtk_1, 0x41 ^ 0x40);
     UPDATE_CTR(tk1);
+    tk_update_1(rtk_1);     // no need to recompute the entire schedule
 		XOR_BLOCK(c, m, out);
 		c     += BLOCKBYTES;
 		m     += BLOCKBYTES;
     mlen  -= BLOCKBYTES;
 	}
-  SET_DOMAIN(tk1, 0x40);
-  tk_schedule_13(rtk_1, rtk_3, tk1, state);
+  tk_schedule_3(rtk_3, state);
   skinny128_384_plus(out, npub, rtk_1, rtk_3);
   zeroize((uint8_t *)rtk_3, sizeof(rtk_3));
   UPDATE_CTR(tk1);
@@ -300,8 +303,8 @@ void romulust_generate_tag(
   const unsigned char *k)
 {
 	uint8_t hash[2*BLOCKBYTES];
-  uint32_t rtk_1[TKPERMORDER*BLOCKBYTES/4];
-  uint32_t rtk_23[SKINNY128_384_ROUNDS*BLOCKBYTES/4];
+  uint32_t rtk_1[RTK1_WORDS];
+  uint32_t rtk_23[RTK23_WORDS];
   romulusht(hash, ad, adlen, c, mlen, npub, tk1);
   zeroize(tk1, BLOCKBYTES);
   SET_DOMAIN(tk1, 0x44);
@@ -9,6 +9,7 @@
  *****************************************************************************/
 #include "immintrin.h"
 #include "skinny128.h"
+#include "skinny_stats.h"
 
 /**
  * Apply the S-box, Add Round Tweakey, and Add Round Constants to the internal
@@ -69,6 +70,7 @@ void skinny128_384_plus(
     const unsigned char *tk1,
     const unsigned char *rtk_23)
 {
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 1);
 
     unsigned char rtk_1[BLOCKBYTES/2*16];
 
@@ -133,6 +135,7 @@ void skinny128_384_plus(
 
     // put internal state into output buffer
     _mm_storeu_si128((__m128i*)out, state);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
 }
 
 /**
@@ -195,6 +198,7 @@ void tk_schedule_23(
     const unsigned char *tk2,
     const unsigned char *tk3)
 {
+    SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_23, 1);
     __m128i tmp0;
     __m128i tmp1;
     __m128i tmp2;
@@ -255,6 +259,7 @@ void tk_schedule_23(
     tmp0    = _mm_xor_si128(tmp0, rtk_3);
     tmp0    = _mm_xor_si128(tmp0, rtk_2);
     _mm_storeu_si64((__m128i*)rtk_23, tmp0);
+    SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_23);
 }
 
 /**
@@ -265,6 +270,7 @@ void tk_schedule_3(
     unsigned char *rtk,
     const unsigned char *tk3)
 {
+    SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_3, 1);
     __m128i tmp0    = {0x0000000000000001, 0x0000000000000000};
     __m128i tmp1;
     __m128i rtk_3   = _mm_loadu_si128((const __m128i*)tk3);
@@ -310,4 +316,5 @@ void tk_schedule_3(
     rtk_3   = _mm_or_si128(rtk_3, tmp1);
     tmp0    = _mm_xor_si128(tmp0, rtk_3);
     _mm_storeu_si128((__m128i*)rtk, tmp0);
+    SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_3);
 }
@@ -12,6 +12,7 @@
 ******************************************************************************/
 #include "skinnyaead.h"
 #include <string.h>
+#include "skinny_stats.h"
 
 /******************************************************************************
 * x ^= y where x, y are 128-bit blocks (16 bytes array).
@@ -30,6 +31,7 @@ int crypto_aead_encrypt (unsigned char *c, unsigned long long *clen,
                     const unsigned char *nsec,
                     const unsigned char *npub,
                     const unsigned char *k) {
+    SKINNY_STATS_BEGIN(SKINNY_STATS_ENCRYPT, 1);
     u64 i,lfsr = 1;
     u8 feedback;
     u32 rtk1[4*16];
@@ -101,6 +103,7 @@ int crypto_aead_encrypt (unsigned char *c, unsigned long long *clen,
     }
     xor_block(c, auth);                 // XOR for tag computation
     // ----------------- Process the associated data -----------------
+    SKINNY_STATS_END(SKINNY_STATS_ENCRYPT);
     return 0;
 }
 
@@ -113,6 +116,7 @@ int crypto_aead_decrypt (unsigned char *m, unsigned long long *mlen,
                     const unsigned char *ad, unsigned long long adlen,
                     const unsigned char *npub,
                     const unsigned char *k) {
+    SKINNY_STATS_BEGIN(SKINNY_STATS_DECRYPT, 1);
     u64 i,lfsr = 1;
     u8 feedback;
     u32 rtk1[4*16];
@@ -190,6 +194,7 @@ int crypto_aead_decrypt (unsigned char *m, unsigned long long *mlen,
     feedback = 0;
     for(i = 0; i < TAGBYTES; i++)
         feedback |= sum[i] ^ c[i];      // constant-time tag verification
+    SKINNY_STATS_END(SKINNY_STATS_DECRYPT);
     return feedback;
     // ----------------- Process the associated data -----------------
 }
\ No newline at end of file
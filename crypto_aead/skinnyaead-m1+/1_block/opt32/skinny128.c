@@ -19,6 +19,7 @@
 * @date		June 2020
 ******************************************************************************/
 #include "skinny128.h"
+#include "skinny_stats.h"
 
 /******************************************************************************
 * The MixColumns computation for rounds i such that (i % 4) == 0
@@ -147,12 +148,14 @@ void inv_mixcolumns_3(u32* state) {
 ******************************************************************************/
 void skinny128_384_plus_encrypt(u8* ctext, const u8* ptext, const u32* rtk1, 
 				const u32* rtk2_3) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 1);
 	u32 tmp; 					// used in SWAPMOVE macro
 	u32 state[4]; 				// 128-bit state
 	packing(state, ptext); 		// from byte to bitsliced representation
 	for(int i = 0; i < 10; i++)
 		QUADRUPLE_ROUND(state, rtk1 + (i%4)*16, rtk2_3 + i*16);
 	unpacking(ctext, state);	// from bitsliced to byte representation
+	SKINNY_STATS_END(SKINNY_STATS_SKINNY);
 }
 
 /******************************************************************************
@@ -162,10 +165,12 @@ void skinny128_384_plus_encrypt(u8* ctext, const u8* ptext, const u32* rtk1,
 ******************************************************************************/
 void skinny128_384_plus_decrypt(u8* ctext, const u8* ptext, const u32* rtk1, 
 				const u32* rtk2_3) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY_INV, 1);
 	u32 tmp; 					// used in SWAPMOVE macro
 	u32 state[4]; 				// 128-bit state
 	packing(state, ptext); 		// from byte to bitsliced representation
 	for(int i = 9; i >= 0; i--)
 		INV_QUADRUPLE_ROUND(state, rtk1 + (i%4)*16, rtk2_3 + i*16);
 	unpacking(ctext, state);	// from bitsliced to byte representation
+	SKINNY_STATS_END(SKINNY_STATS_SKINNY_INV);
 }
\ No newline at end of file
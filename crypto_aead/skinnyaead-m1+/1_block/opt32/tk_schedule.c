@@ -8,6 +8,7 @@
 ******************************************************************************/
 #include <string.h>
 #include "skinny128.h"
+#include "skinny_stats.h"
 
 /******************************************************************************
 * The round constants according to the new representation.
@@ -415,6 +416,7 @@ void permute_tk(u32* tk, const u8* key, const int rounds) {
 * Precompute LFSR2(TK2) ^ LFSR3(TK3) ^ rconst.
 ******************************************************************************/
 void precompute_rtk2_3(u32* rtk, const u8* tk2, const u8 * tk3) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_23, 1);
 	memset(rtk, 0x00, 16*SKINNY128_384_ROUNDS);
 	precompute_lfsr_tk2_3(rtk, tk2, tk3, SKINNY128_384_ROUNDS);
 	permute_tk(rtk, (u8*)(rtk+8), SKINNY128_384_ROUNDS);	// rtk+8 is NULL
@@ -422,12 +424,15 @@ void precompute_rtk2_3(u32* rtk, const u8* tk2, const u8 * tk3) {
 		for(int j = 0; j < 4; j++)
 			rtk[i*4+j] ^= rconst_32_bs[i*4+j];
 	}
+	SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_23);
 }
 
 /******************************************************************************
 * Precompute RTK1.
 ******************************************************************************/
 void precompute_rtk1(u32* rtk1, const u8* tk1) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_1, 1);
 	memset(rtk1, 0x00, 16*16);
 	permute_tk(rtk1, tk1, 16);
+	SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_1);
 }
\ No newline at end of file
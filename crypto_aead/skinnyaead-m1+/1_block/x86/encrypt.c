@@ -0,0 +1 @@
+../../../skinnyaead-m1/1_block/x86/encrypt.c
\ No newline at end of file
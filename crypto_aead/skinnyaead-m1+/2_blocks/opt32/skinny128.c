@@ -19,6 +19,7 @@
 * @date		June 2020
 ******************************************************************************/
 #include "skinny128.h"
+#include "skinny_stats.h"
 
 /****************************************************************************
 * The MixColumns operation for rounds i such that (i % 4) == 0.
@@ -161,11 +162,13 @@ void add_tweakey(u32* state, const u32* rtk1, const u32* rtk2_3) {
 ****************************************************************************/
 void skinny128_384_plus_encrypt(u8* ctext, u8* ctext_bis, const u8* ptext, 
 					const u8* ptext_bis, const tweakey tk) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 2);
 	u32 state[8];
 	packing(state, ptext, ptext_bis);
 	for(int i = 0; i < 10; i++)
 		QUADRUPLE_ROUND(state, tk.rtk1 + (i%4)*32, tk.rtk2_3 + i*32);
 	unpacking(ctext, ctext_bis, state);
+	SKINNY_STATS_END(SKINNY_STATS_SKINNY);
 }
 
 /****************************************************************************
@@ -175,9 +178,11 @@ void skinny128_384_plus_encrypt(u8* ctext, u8* ctext_bis, const u8* ptext,
 ****************************************************************************/
 void skinny128_384_plus_decrypt(u8* ptext, u8* ptext_bis, const u8* ctext, 
 					const u8* ctext_bis, const tweakey tk) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY_INV, 2);
 	u32 state[8];
 	packing(state, ctext, ctext_bis);
 	for(int i = 9; i >= 0; i--)
 		INV_QUADRUPLE_ROUND(state, tk.rtk1 + (i%4)*32, tk.rtk2_3 + i*32);
 	unpacking(ptext, ptext_bis, state);
+	SKINNY_STATS_END(SKINNY_STATS_SKINNY_INV);
 }
@@ -11,6 +11,7 @@
 *******************************************************************************/
 #include <string.h>
 #include "tk_schedule.h"
+#include "skinny_stats.h"
 
 /****************************************************************************
 * The round constants according to the fixsliced representation.
@@ -443,6 +444,7 @@ void permute_tk(u32* tk, const u8* tk1_0, const u8* tk1_1, const int rounds) {
 
 //Precompute LFSR2(TK2) ^ LFSR3(TK3) ^ rconst
 void precompute_rtk2_3(u32* rtk, const u8* tk2, const u8 * tk3, int rounds) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_23, 1);
 	memset(rtk, 0x00, 32*rounds);
 	precompute_lfsr_tk2(rtk, tk2, tk2, rounds);
 	precompute_lfsr_tk3(rtk, tk3, tk3, rounds);
@@ -451,10 +453,13 @@ void precompute_rtk2_3(u32* rtk, const u8* tk2, const u8 * tk3, int rounds) {
 		for(int j = 0; j < 8; j++)
 			rtk[i*8+j] ^= rconst_32_bs[i*8+j];
 	}
+	SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_23);
 }
 
 //Precompute TK1
 void precompute_rtk1(u32* rtk1, const u8* tk1, const u8* tk1_bis) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_1, 1);
 	memset(rtk1, 0x00, 32*16);
 	permute_tk(rtk1, tk1, tk1_bis, 16);
+	SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_1);
 }
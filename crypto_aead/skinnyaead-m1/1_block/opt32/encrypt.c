@@ -10,6 +10,7 @@
 ******************************************************************************/
 #include "skinnyaead.h"
 #include <string.h>
+#include "skinny_stats.h"
 
 /******************************************************************************
 * x ^= y where x, y are 128-bit blocks (16 bytes array).
@@ -28,6 +29,7 @@ int crypto_aead_encrypt (unsigned char *c, unsigned long long *clen,
                     const unsigned char *nsec,
                     const unsigned char *npub,
                     const unsigned char *k) {
+    SKINNY_STATS_BEGIN(SKINNY_STATS_ENCRYPT, 1);
     u64 i,lfsr = 1;
     u8 feedback;
     u32 rtk1[4*16];
@@ -99,6 +101,7 @@ int crypto_aead_encrypt (unsigned char *c, unsigned long long *clen,
     }
     xor_block(c, auth);                 // XOR for tag computation
     // ----------------- Process the associated data -----------------
+    SKINNY_STATS_END(SKINNY_STATS_ENCRYPT);
     return 0;
 }
 
@@ -111,6 +114,7 @@ int crypto_aead_decrypt (unsigned char *m, unsigned long long *mlen,
                     const unsigned char *ad, unsigned long long adlen,
                     const unsigned char *npub,
                     const unsigned char *k) {
+    SKINNY_STATS_BEGIN(SKINNY_STATS_DECRYPT, 1);
     u64 i,lfsr = 1;
     u8 feedback;
     u32 rtk1[4*16];
@@ -188,6 +192,7 @@ int crypto_aead_decrypt (unsigned char *m, unsigned long long *mlen,
     feedback = 0;
     for(i = 0; i < TAGBYTES; i++)
         feedback |= sum[i] ^ c[i];      // constant-time tag verification
+    SKINNY_STATS_END(SKINNY_STATS_DECRYPT);
     return feedback;
     // ----------------- Process the associated data -----------------
 }
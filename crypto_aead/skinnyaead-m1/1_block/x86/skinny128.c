@@ -0,0 +1 @@
+../../../../crypto_tbc/skinny128/simd/x86/skinny128.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../crypto_tbc/skinny128/stats/skinny_stats.h
\ No newline at end of file
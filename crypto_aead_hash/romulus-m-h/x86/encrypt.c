@@ -1 +1 @@
-../../../crypto_aead/romulus-m/x86/encrypt.c
\ No newline at end of file
+../../../crypto_aead/romulus-m/armv8a/precalculate/encrypt.c
\ No newline at end of file
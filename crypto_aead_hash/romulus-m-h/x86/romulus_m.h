@@ -1 +1 @@
-../../../crypto_aead/romulus-m/x86/romulus_m.h
\ No newline at end of file
+../../../crypto_aead/romulus-m/armv8a/precalculate/romulus_m.h
\ No newline at end of file
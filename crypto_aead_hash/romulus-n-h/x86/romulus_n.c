@@ -1 +1 @@
-../../../crypto_aead/romulus-n/x86/romulus_n.c
\ No newline at end of file
+../../../crypto_aead/romulus-n/armv8a/precalculate/romulus_n.c
\ No newline at end of file
@@ -1 +1 @@
-../../../crypto_hash/romulus-h/x86/hash.c
\ No newline at end of file
+../../../crypto_hash/romulus-h/armv8a/precalculate/hash.c
\ No newline at end of file
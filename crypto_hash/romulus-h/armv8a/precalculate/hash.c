@@ -8,6 +8,7 @@
  */
 #include "skinny128.h"
 #include "crypto_hash.h"
+#include "skinny_stats.h"
 
 static void hirose_128_128_256(
   unsigned char h[],
@@ -60,6 +61,7 @@ int crypto_hash
 	(unsigned char *out,
 	 const unsigned char *in,
 	 unsigned long long inlen) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_HASH, 1);
 
 	unsigned char h[BLOCKBYTES];
 	unsigned char g[BLOCKBYTES];
@@ -82,5 +84,6 @@ int crypto_hash
 		out[i] = h[i];
 		out[i+BLOCKBYTES] = g[i];
 	}
+	SKINNY_STATS_END(SKINNY_STATS_HASH);
 	return 0;
 }
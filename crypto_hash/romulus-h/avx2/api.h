@@ -0,0 +1 @@
+../armv7a/api.h
\ No newline at end of file
@@ -0,0 +1 @@
+../armv7a/crypto_hash.h
\ No newline at end of file
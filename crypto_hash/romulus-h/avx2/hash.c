@@ -0,0 +1,99 @@
+/**
+ * Romulus-H implementation following the SUPERCOP API, on top of the 2-block
+ * AVX2 fixsliced Skinny-128-384+ from 'crypto_tbc/skinny128/bitsliced': both
+ * blocks of the Hirose compression function are encrypted under the same
+ * tweakey, hence within a single YMM register.
+ */
+#include <string.h>
+#include "skinny128.h"
+#include "crypto_hash.h"
+#include "skinny_stats.h"
+
+#define BLOCKBYTES 16
+
+/**
+ * Hirose's double-block length compression function, where 'h' and 'h ^ 1'
+ * are encrypted at once under the tweakey (g, m).
+ */
+static void hirose_128_128_256(
+  unsigned char h[],
+  unsigned char g[],
+  const unsigned char m[])
+{
+  uint16_t i;
+  uint8_t x[2*BLOCKBYTES];
+  tweakey tk;
+  __m128i rtk[SKINNY128_384_PLUS_ROUNDS];
+
+  memcpy(tk.tk1, g, BLOCKBYTES);
+  memcpy(tk.tk2, m, BLOCKBYTES);
+  memcpy(tk.tk3, m+BLOCKBYTES, BLOCKBYTES);
+  precompute_rtk_plus(rtk, &tk);
+  memcpy(x, h, BLOCKBYTES);
+  memcpy(x+BLOCKBYTES, h, BLOCKBYTES);
+  x[BLOCKBYTES] ^= 0x01;
+  core_skinny128_enc_x2(x, x, rtk, SKINNY128_384_PLUS_ROUNDS);
+
+  memset(rtk, 0x00, sizeof(rtk));
+  memset(&tk, 0x00, sizeof(tk));
+
+  for (i = 0; i < BLOCKBYTES; i++) {
+    g[i] = x[BLOCKBYTES+i] ^ h[i];
+    h[i] ^= x[i];
+  }
+  g[0] ^= 0x01;
+}
+
+void initialize
+	(unsigned char* h,
+	 unsigned char* g)
+{
+	unsigned char i;
+	for (i = 0; i < BLOCKBYTES; i++) {
+		h[i] = 0;
+		g[i] = 0;
+	}
+}
+
+void pad(const unsigned char* m, unsigned char* mp, int l, int len8) {
+	int i;
+	for (i = 0; i < l; i++) {
+		if (i < len8)
+			mp[i] = m[i];
+		else if (i == l - 1)
+      		mp[i] = (len8 & 0x1f);
+		else
+			mp[i] = 0x00;
+	}
+}
+
+int crypto_hash
+	(unsigned char *out,
+	 const unsigned char *in,
+	 unsigned long long inlen) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_HASH, 1);
+
+	unsigned char h[BLOCKBYTES];
+	unsigned char g[BLOCKBYTES];
+	unsigned char p[2*BLOCKBYTES];
+	unsigned char i;
+
+	initialize(h,g);
+	
+	while (inlen >= 2*BLOCKBYTES) { // Normal loop
+		hirose_128_128_256(h,g,in);
+		in += 2*BLOCKBYTES;
+		inlen -= 2*BLOCKBYTES;
+	}
+
+	pad(in,p,2*BLOCKBYTES,inlen);
+	h[0] ^= 2;
+	hirose_128_128_256(h,g,p);
+
+	for (i = 0; i < BLOCKBYTES; i++) { // Assign the output tag
+		out[i] = h[i];
+		out[i+BLOCKBYTES] = g[i];
+	}
+	SKINNY_STATS_END(SKINNY_STATS_HASH);
+	return 0;
+}
@@ -0,0 +1 @@
+../../../crypto_tbc/skinny128/bitsliced/2_blocks/avx2/skinny128.h
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "skinny128.h"
 #include "tk_schedule.h"
 #include "crypto_hash.h"
+#include "skinny_stats.h"
 
 void hirose_128_128_256
 	(unsigned char* h,
@@ -12,8 +13,8 @@ void hirose_128_128_256
 
 	uint8_t hh[BLOCKBYTES];
 	int i;
-    uint32_t rtk_1[BLOCKBYTES*SKINNY128_384_ROUNDS/4];
-    uint32_t rtk_23[BLOCKBYTES*SKINNY128_384_ROUNDS/4];
+    uint32_t rtk_1[RTK1_WORDS];
+    uint32_t rtk_23[RTK23_WORDS];
 
     // precompute the round tweakeys
     tk_schedule_23(rtk_23, m, m+BLOCKBYTES);
@@ -29,7 +30,7 @@ void hirose_128_128_256
 	skinny128_384_plus(h, h, rtk_1, rtk_23);
 	skinny128_384_plus(g, g, rtk_1, rtk_23);
 
-	for(i = 0; i < BLOCKBYTES*SKINNY128_384_ROUNDS/4; i++)
+	for(i = 0; i < RTK23_WORDS; i++)
 		rtk_23[i] = 0x00000000;
 
 	for (i = 0; i < BLOCKBYTES; i++) {
@@ -66,6 +67,7 @@ int crypto_hash
 	(unsigned char *out,
 	 const unsigned char *in,
 	 unsigned long long inlen) {
+	SKINNY_STATS_BEGIN(SKINNY_STATS_HASH, 1);
 
 	unsigned char h[BLOCKBYTES];
 	unsigned char g[BLOCKBYTES];
@@ -88,5 +90,6 @@ int crypto_hash
 		out[i] = h[i];
 		out[i+BLOCKBYTES] = g[i];
 	}
+	SKINNY_STATS_END(SKINNY_STATS_HASH);
 	return 0;
 }
@@ -1 +0,0 @@
-../armv8a/precalculate/hash.c
\ No newline at end of file
@@ -23,6 +23,42 @@
 #define MASK_6 	_mm_set_epi32(0x07060504, 0x0f0e0d0c, 0x80808080, 0x80808080)
 #define MASK_7 	_mm_set_epi32(0x80808080, 0x80808080, 0x80808080, 0x0f0e0d0c)
 
+// masks for fixsliced inverse MixColumns: MASK_0/2/4/6 each compute two
+// chained row additions, hence their inverses need the masks applied twice
+#define MASK_0_SQ 	_mm_set_epi32(0x80808080, 0x80808080, 0x00030201, 0x80808080)
+#define MASK_2_SQ 	_mm_set_epi32(0x80808080, 0x80808080, 0x80808080, 0x0d0c0f0e)
+#define MASK_4_SQ 	_mm_set_epi32(0x0a09080b, 0x80808080, 0x80808080, 0x80808080)
+#define MASK_6_SQ 	_mm_set_epi32(0x80808080, 0x07060504, 0x80808080, 0x80808080)
+
+#if defined(SKINNY_GFNI)
+#if !defined(__GFNI__)
+#error "SKINNY_GFNI requires GFNI support (e.g. -mgfni)"
+#endif
+/******************************************************************************
+* All the bit permutations within bytes are computed through a single
+* 'gf2p8affineqb' each: output bit i of every byte is the parity of the input
+* byte AND-ed with byte (7-i) of the 64-bit matrix operand, so that a matrix
+* having byte (7-i) set to (1 << j) moves bit j to bit i.
+******************************************************************************/
+#define BYTE_PERMUTATION(x, m) 									\
+	_mm_gf2p8affine_epi64_epi8(x, _mm_set1_epi64x(m), 0)
+
+// permutation to match the inner-fixsliced sbox representation
+#define IN_PERMUTATION(x) 	((x) = BYTE_PERMUTATION(x, 0x0408010220408010))
+
+// inverse permutation of 'IN_PERMUTATION'
+#define OUT_PERMUTATION(x) 	((x) = BYTE_PERMUTATION(x, 0x0408010280102040))
+
+// rotation of every byte by 1 bit to the right
+#define ROR_1(x) 			BYTE_PERMUTATION(x, 0x0204081020408001)
+
+// swaps of 2 bits within every byte at the end of the sboxes
+#define SWAP_5_6(x) 		BYTE_PERMUTATION(x, 0x0102040810402080)
+#define SWAP_4_7(x) 		BYTE_PERMUTATION(x, 0x0102040880204010)
+#define SWAP_1_2(x) 		BYTE_PERMUTATION(x, 0x0104020810204080)
+#define SWAP_0_3(x) 		BYTE_PERMUTATION(x, 0x0802040110204080)
+
+#else
 // permutation to match the inner-fixsliced sbox representation
 #define IN_PERMUTATION(x) ({									\
 	tmp0 = _mm_and_si128(x, _mm_set1_epi32(0x03030303));		\
@@ -47,15 +83,58 @@
 	(x) = _mm_or_si128(tmp0, _mm_srli_epi32(tmp1, 2));			\
 })
 
+// rotation of every byte by 1 bit to the right
+#define ROR_1(x) ({											\
+	tmp0 	= _mm_and_si128(x, _mm_set1_epi32(0xfefefefe));		\
+	tmp0 	= _mm_srli_epi32(tmp0, 1);							\
+	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x01010101));		\
+	_mm_or_si128(tmp0, _mm_slli_epi32(tmp1, 7));				\
+})
+
+// swap of bits 5 and 6 within every byte
+#define SWAP_5_6(x) ({										\
+	tmp0 	= _mm_and_si128(x, _mm_set1_epi32(0x9f9f9f9f));		\
+	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x40404040));		\
+	tmp0 	= _mm_or_si128(tmp0, _mm_srli_epi32(tmp1, 1));		\
+	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x20202020));		\
+	_mm_or_si128(tmp0, _mm_slli_epi32(tmp1, 1));				\
+})
+
+// swap of bits 4 and 7 within every byte
+#define SWAP_4_7(x) ({										\
+	tmp0 	= _mm_and_si128(x, _mm_set1_epi32(0x6f6f6f6f));		\
+	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x80808080));		\
+	tmp0 	= _mm_or_si128(tmp0, _mm_srli_epi32(tmp1, 3));		\
+	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x10101010));		\
+	_mm_or_si128(tmp0, _mm_slli_epi32(tmp1, 3));				\
+})
+
+// swap of bits 1 and 2 within every byte
+#define SWAP_1_2(x) ({										\
+	tmp0 	= _mm_and_si128(x, _mm_set1_epi32(0xf9f9f9f9));		\
+	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x04040404));		\
+	tmp0 	= _mm_or_si128(tmp0, _mm_srli_epi32(tmp1, 1));		\
+	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x02020202));		\
+	_mm_or_si128(tmp0, _mm_slli_epi32(tmp1, 1));				\
+})
+
+// swap of bits 0 and 3 within every byte
+#define SWAP_0_3(x) ({										\
+	tmp0 	= _mm_and_si128(x, _mm_set1_epi32(0xf6f6f6f6));		\
+	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x08080808));		\
+	tmp0 	= _mm_or_si128(tmp0, _mm_srli_epi32(tmp1, 3));		\
+	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x01010101));		\
+	_mm_or_si128(tmp0, _mm_slli_epi32(tmp1, 3));				\
+})
+
+#endif /* SKINNY_GFNI */
+
 // 1st sbox according to the inner-fixsliced representation
 #define SBOX_0(x) ({											\
 	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 1));			\
 	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x21212121));	\
 	(x) 	= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 2));		\
-	tmp0 	= _mm_and_si128(x, _mm_set1_epi32(0xfefefefe));		\
-	tmp0 	= _mm_srli_epi32(tmp0, 1);							\
-	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x01010101));		\
-	tmp0 	= _mm_or_si128(tmp0, _mm_slli_epi32(tmp1, 7));		\
+	tmp0 	= ROR_1(x);											\
 	tmp0 	= _mm_and_si128(tmp0, _mm_srli_epi32(tmp0, 5));		\
 	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x06060606));	\
 	(x)		= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 3));		\
@@ -65,11 +144,7 @@
 	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 3));			\
 	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x18181818));	\
 	(x) 	= _mm_xor_si128(x, _mm_srli_epi32(tmp0, 3));		\
-	tmp0 	= _mm_and_si128(x, _mm_set1_epi32(0x9f9f9f9f));		\
-	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x40404040));		\
-	tmp0 	= _mm_or_si128(tmp0, _mm_srli_epi32(tmp1, 1));		\
-	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x20202020));		\
-	(x) 	= _mm_or_si128(tmp0, _mm_slli_epi32(tmp1, 1));		\
+	(x) 	= SWAP_5_6(x);										\
 })
 
 // 2nd sbox according to the inner-fixsliced representation
@@ -80,21 +155,14 @@
 	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 1));			\
 	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x21212121));	\
 	(x) 	= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 2));		\
-	tmp0 	= _mm_and_si128(x, _mm_set1_epi32(0xfefefefe));		\
-	tmp0 	= _mm_srli_epi32(tmp0, 1);							\
-	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x01010101));		\
-	tmp0 	= _mm_or_si128(tmp0, _mm_slli_epi32(tmp1, 7));		\
+	tmp0 	= ROR_1(x);											\
 	tmp0 	= _mm_and_si128(tmp0, _mm_srli_epi32(tmp0, 5));		\
 	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x06060606));	\
 	(x)		= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 3));		\
 	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 1));			\
 	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x12121212));	\
 	(x) 	= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 2));		\
-	tmp0 	= _mm_and_si128(x, _mm_set1_epi32(0x6f6f6f6f));		\
-	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x80808080));		\
-	tmp0 	= _mm_or_si128(tmp0, _mm_srli_epi32(tmp1, 3));		\
-	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x10101010));		\
-	(x) 	= _mm_or_si128(tmp0, _mm_slli_epi32(tmp1, 3));		\
+	(x) 	= SWAP_4_7(x);										\
 })
 
 // 3rd sbox according to the inner-fixsliced representation
@@ -108,26 +176,16 @@
 	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 1));			\
 	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x21212121));	\
 	(x) 	= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 2));		\
-	tmp0 	= _mm_and_si128(x, _mm_set1_epi32(0xfefefefe));		\
-	tmp0 	= _mm_srli_epi32(tmp0, 1);							\
-	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x01010101));		\
-	tmp0 	= _mm_or_si128(tmp0, _mm_slli_epi32(tmp1, 7));		\
+	tmp0 	= ROR_1(x);											\
 	tmp0 	= _mm_and_si128(tmp0, _mm_srli_epi32(tmp0, 5));		\
 	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x06060606));	\
 	(x)		= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 3));		\
-	tmp0 	= _mm_and_si128(x, _mm_set1_epi32(0xf9f9f9f9));		\
-	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x04040404));		\
-	tmp0 	= _mm_or_si128(tmp0, _mm_srli_epi32(tmp1, 1));		\
-	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x02020202));		\
-	(x) 	= _mm_or_si128(tmp0, _mm_slli_epi32(tmp1, 1));		\
+	(x) 	= SWAP_1_2(x);										\
 })
 
 // 4th sbox according to the inner-fixsliced representation
 #define SBOX_3(x) ({ 											\
-	tmp0 	= _mm_and_si128(x, _mm_set1_epi32(0xfefefefe));		\
-	tmp0 	= _mm_srli_epi32(tmp0, 1);							\
-	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x01010101));		\
-	tmp0 	= _mm_or_si128(tmp0, _mm_slli_epi32(tmp1, 7));		\
+	tmp0 	= ROR_1(x);											\
 	tmp0 	= _mm_and_si128(tmp0, _mm_srli_epi32(tmp0, 5));		\
 	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x06060606));	\
 	(x) 	= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 3));		\
@@ -140,11 +198,81 @@
 	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 1));			\
 	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x21212121));	\
 	(x) 	= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 2));		\
-	tmp0 	= _mm_and_si128(x, _mm_set1_epi32(0xf6f6f6f6));		\
-	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x08080808));		\
-	tmp0 	= _mm_or_si128(tmp0, _mm_srli_epi32(tmp1, 3));		\
-	tmp1 	= _mm_and_si128(x, _mm_set1_epi32(0x01010101));		\
-	(x) 	= _mm_or_si128(tmp0, _mm_slli_epi32(tmp1, 3));		\
+	(x) 	= SWAP_0_3(x);										\
+})
+
+/******************************************************************************
+* Inverse sboxes according to the inner-fixsliced representation.
+* Every step of the sboxes only modifies bits which it does not read, so that
+* it is an involution: the inverses apply the final swap first, then the same
+* steps in reverse order.
+******************************************************************************/
+#define INV_SBOX_0(x) ({										\
+	(x) 	= SWAP_5_6(x);										\
+	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 3));			\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x18181818));	\
+	(x) 	= _mm_xor_si128(x, _mm_srli_epi32(tmp0, 3));		\
+	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 1));			\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x12121212));	\
+	(x) 	= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 2));		\
+	tmp0 	= ROR_1(x);											\
+	tmp0 	= _mm_and_si128(tmp0, _mm_srli_epi32(tmp0, 5));		\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x06060606));	\
+	(x)		= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 3));		\
+	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 1));			\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x21212121));	\
+	(x) 	= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 2));		\
+})
+
+#define INV_SBOX_1(x) ({										\
+	(x) 	= SWAP_4_7(x);										\
+	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 1));			\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x12121212));	\
+	(x) 	= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 2));		\
+	tmp0 	= ROR_1(x);											\
+	tmp0 	= _mm_and_si128(tmp0, _mm_srli_epi32(tmp0, 5));		\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x06060606));	\
+	(x)		= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 3));		\
+	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 1));			\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x21212121));	\
+	(x) 	= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 2));		\
+	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 3));			\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x18181818));	\
+	(x) 	= _mm_xor_si128(x, _mm_srli_epi32(tmp0, 3));		\
+})
+
+#define INV_SBOX_2(x) ({										\
+	(x) 	= SWAP_1_2(x);										\
+	tmp0 	= ROR_1(x);											\
+	tmp0 	= _mm_and_si128(tmp0, _mm_srli_epi32(tmp0, 5));		\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x06060606));	\
+	(x)		= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 3));		\
+	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 1));			\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x21212121));	\
+	(x) 	= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 2));		\
+	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 3));			\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x18181818));	\
+	(x) 	= _mm_xor_si128(x, _mm_srli_epi32(tmp0, 3));		\
+	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 1));			\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x12121212));	\
+	(x) 	= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 2));		\
+})
+
+#define INV_SBOX_3(x) ({ 										\
+	(x) 	= SWAP_0_3(x);										\
+	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 1));			\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x21212121));	\
+	(x) 	= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 2));		\
+	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 3));			\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x18181818));	\
+	(x) 	= _mm_xor_si128(x, _mm_srli_epi32(tmp0, 3));		\
+	tmp0 	= _mm_and_si128(x, _mm_srli_epi32(x, 1));			\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x12121212));	\
+	(x) 	= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 2));		\
+	tmp0 	= ROR_1(x);											\
+	tmp0 	= _mm_and_si128(tmp0, _mm_srli_epi32(tmp0, 5));		\
+	tmp0 	= _mm_and_si128(tmp0, _mm_set1_epi32(0x06060606));	\
+	(x)		= _mm_xor_si128(x, _mm_slli_epi32(tmp0, 3));		\
 })
 
 // MixColumns (the row permutation is omitted)
@@ -153,6 +281,15 @@
 	(x)	= _mm_xor_si128(x, _mm_shuffle_epi8(x, m1));			\
 })
 
+// Inverse MixColumns: 'm1' defines an involution while 'm0' is nilpotent of
+// order 3, so that (I + M0)^-1 = I + M0 + M0^2 where 'm0_sq' defines M0^2
+#define INV_MIXCOLUMNS(x, m0, m0_sq, m1) ({						\
+	(x) = _mm_xor_si128(x, _mm_shuffle_epi8(x, m1));			\
+	tmp0 = _mm_xor_si128(_mm_shuffle_epi8(x, m0),				\
+		_mm_shuffle_epi8(x, m0_sq));							\
+	(x) = _mm_xor_si128(x, tmp0);								\
+})
+
 // Add round tweakey (includes the rconsts and NOTs for the Sbox)
 #define ADDROUNDTWEAKEY(x, rtk) ((x) = _mm_xor_si128(x, (rtk)))
 
@@ -172,6 +309,22 @@
 	MIXCOLUMNS(x, MASK_6, MASK_7);								\
 })
 
+// Inverse quadruple round routine
+#define INV_QUADRUPLE_ROUND(x, rtk) ({							\
+	INV_MIXCOLUMNS(x, MASK_6, MASK_6_SQ, MASK_7);				\
+	ADDROUNDTWEAKEY(x, *(rtk+3));								\
+	INV_SBOX_3(x);												\
+	INV_MIXCOLUMNS(x, MASK_4, MASK_4_SQ, MASK_5);				\
+	ADDROUNDTWEAKEY(x, *(rtk+2));								\
+	INV_SBOX_2(x);												\
+	INV_MIXCOLUMNS(x, MASK_2, MASK_2_SQ, MASK_3);				\
+	ADDROUNDTWEAKEY(x, *(rtk+1));								\
+	INV_SBOX_1(x);												\
+	INV_MIXCOLUMNS(x, MASK_0, MASK_0_SQ, MASK_1);				\
+	ADDROUNDTWEAKEY(x, *(rtk));									\
+	INV_SBOX_0(x);												\
+})
+
 /******************************************************************************
 * Core function for SKINNY128 encryption.
 * Note that the main loop relies on a quadruple round routine. Even though the
@@ -184,6 +337,7 @@ void core_skinny128_enc(uint8_t* out, const uint8_t* in,
 				const __m128i* rtk, int rounds) {
 	// load the 16-byte input in a 128-bit register
 	__m128i tmp0, tmp1, state = _mm_loadu_si128((__m128i*)in);
+	(void)tmp1; // unused if the permutations rely on GFNI
 	// apply a permutation on the state to enhance Sboxes calculations
 	IN_PERMUTATION(state);
 	// negates the whole state for Sbox computations
@@ -198,6 +352,30 @@ void core_skinny128_enc(uint8_t* out, const uint8_t* in,
 	_mm_storeu_si128((__m128i*)out, state);
 }
 
+/******************************************************************************
+* Core function for SKINNY128 decryption.
+* It takes the same round tweakeys as 'core_skinny128_enc' (as computed by
+* 'precompute_rtk' or 'precompute_rtk_plus') and processes them in reverse
+* order, undoing the bit permutations and the initial NOT in the same way.
+******************************************************************************/
+void core_skinny128_dec(uint8_t* out, const uint8_t* in,
+				const __m128i* rtk, int rounds) {
+	// load the 16-byte input in a 128-bit register
+	__m128i tmp0, tmp1, state = _mm_loadu_si128((__m128i*)in);
+	(void)tmp1; // unused if the permutations rely on GFNI
+	// undo the output permutation applied at the end of the encryption
+	IN_PERMUTATION(state);
+	// core routine relies on inverse quadruple rounds
+	for(int i = rounds - 4; i >= 0; i -= 4)
+		INV_QUADRUPLE_ROUND(state, rtk+i);
+	// undo the NOT applied at the beginning of the encryption
+	state = _mm_xor_si128(state, _mm_set1_epi32(0xffffffff));
+	// undo the input permutation applied at the beginning of the encryption
+	OUT_PERMUTATION(state);
+	// store the 128-bit state register at the output address
+	_mm_storeu_si128((__m128i*)out, state);
+}
+
 /******************************************************************************
 * Encryption of a single block using SKINNY-128-128 without any operation mode.
 ******************************************************************************/
@@ -233,3 +411,39 @@ void skinny128_384_plus_enc(uint8_t* out, const uint8_t* in, const tweakey* tk)
     precompute_rtk_plus(rtk, tk);
     core_skinny128_enc(out, in, rtk, SKINNY128_384_PLUS_ROUNDS);
 }
+
+/******************************************************************************
+* Decryption of a single block using SKINNY-128-128 without any operation mode.
+******************************************************************************/
+void skinny128_128_dec(uint8_t* out, const uint8_t* in, const tweakey* tk) {
+  	__m128i rtk[SKINNY128_128_ROUNDS];
+    precompute_rtk(rtk, tk, SKINNY128_128_ROUNDS);
+    core_skinny128_dec(out, in, rtk, SKINNY128_128_ROUNDS);
+}
+
+/******************************************************************************
+* Decryption of a single block using SKINNY-128-256 without any operation mode.
+******************************************************************************/
+void skinny128_256_dec(uint8_t* out, const uint8_t* in, const tweakey* tk) {
+  	__m128i rtk[SKINNY128_256_ROUNDS];
+    precompute_rtk(rtk, tk, SKINNY128_256_ROUNDS);
+    core_skinny128_dec(out, in, rtk, SKINNY128_256_ROUNDS);
+}
+
+/******************************************************************************
+* Decryption of a single block using SKINNY-128-384 without any operation mode.
+******************************************************************************/
+void skinny128_384_dec(uint8_t* out, const uint8_t* in, const tweakey* tk) {
+  	__m128i rtk[SKINNY128_384_ROUNDS];
+    precompute_rtk(rtk, tk, SKINNY128_384_ROUNDS);
+    core_skinny128_dec(out, in, rtk, SKINNY128_384_ROUNDS);
+}
+
+/******************************************************************************
+* Decryption of a single block using SKINNY-128-384+ without any operation mode.
+******************************************************************************/
+void skinny128_384_plus_dec(uint8_t* out, const uint8_t* in, const tweakey* tk) {
+  	__m128i rtk[SKINNY128_384_PLUS_ROUNDS];
+    precompute_rtk_plus(rtk, tk);
+    core_skinny128_dec(out, in, rtk, SKINNY128_384_PLUS_ROUNDS);
+}
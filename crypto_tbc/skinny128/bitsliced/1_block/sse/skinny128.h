@@ -8,9 +8,20 @@
 #define SKINNY128_384_ROUNDS 		56
 #define SKINNY128_384_PLUS_ROUNDS 	SKINNY128_128_ROUNDS
 
-void skinny128_128(uint8_t* out, const uint8_t* in, const tweakey* tk);
-void skinny128_256(uint8_t* out, const uint8_t* in, const tweakey* tk);
-void skinny128_384(uint8_t* out, const uint8_t* in, const tweakey* tk);
-void skinny128_384_plus(uint8_t* out, const uint8_t* in, const tweakey* tk);
+// 'rtk' as computed by 'precompute_rtk' or 'precompute_rtk_plus'
+void core_skinny128_enc(uint8_t* out, const uint8_t* in,
+				const __m128i* rtk, int rounds);
+void core_skinny128_dec(uint8_t* out, const uint8_t* in,
+				const __m128i* rtk, int rounds);
+void skinny128_128_enc(uint8_t* out, const uint8_t* in, const tweakey* tk);
+void skinny128_256_enc(uint8_t* out, const uint8_t* in, const tweakey* tk);
+void skinny128_384_enc(uint8_t* out, const uint8_t* in, const tweakey* tk);
+void skinny128_384_plus_enc(uint8_t* out, const uint8_t* in,
+				const tweakey* tk);
+void skinny128_128_dec(uint8_t* out, const uint8_t* in, const tweakey* tk);
+void skinny128_256_dec(uint8_t* out, const uint8_t* in, const tweakey* tk);
+void skinny128_384_dec(uint8_t* out, const uint8_t* in, const tweakey* tk);
+void skinny128_384_plus_dec(uint8_t* out, const uint8_t* in,
+				const tweakey* tk);
 
 #endif  // SKINNY128_H_
\ No newline at end of file
@@ -0,0 +1,28 @@
+#ifndef SKINNY128_H_
+#define SKINNY128_H_
+
+#include "tk_schedule.h"
+
+#define SKINNY128_128_ROUNDS 		40
+#define SKINNY128_256_ROUNDS 		48
+#define SKINNY128_384_ROUNDS 		56
+#define SKINNY128_384_PLUS_ROUNDS 	SKINNY128_128_ROUNDS
+
+// 'in' and 'out' point to 2 consecutive blocks, both processed under 'tk'
+// ('rtk' as computed by 'precompute_rtk' or 'precompute_rtk_plus')
+void core_skinny128_enc_x2(uint8_t* out, const uint8_t* in,
+				const __m128i* rtk, int rounds);
+void core_skinny128_dec_x2(uint8_t* out, const uint8_t* in,
+				const __m128i* rtk, int rounds);
+void skinny128_128_enc_x2(uint8_t* out, const uint8_t* in, const tweakey* tk);
+void skinny128_256_enc_x2(uint8_t* out, const uint8_t* in, const tweakey* tk);
+void skinny128_384_enc_x2(uint8_t* out, const uint8_t* in, const tweakey* tk);
+void skinny128_384_plus_enc_x2(uint8_t* out, const uint8_t* in,
+				const tweakey* tk);
+void skinny128_128_dec_x2(uint8_t* out, const uint8_t* in, const tweakey* tk);
+void skinny128_256_dec_x2(uint8_t* out, const uint8_t* in, const tweakey* tk);
+void skinny128_384_dec_x2(uint8_t* out, const uint8_t* in, const tweakey* tk);
+void skinny128_384_plus_dec_x2(uint8_t* out, const uint8_t* in,
+				const tweakey* tk);
+
+#endif  // SKINNY128_H_
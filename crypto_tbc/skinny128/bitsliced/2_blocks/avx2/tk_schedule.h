@@ -0,0 +1 @@
+../../1_block/sse/tk_schedule.h
\ No newline at end of file
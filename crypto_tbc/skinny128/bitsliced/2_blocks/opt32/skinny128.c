@@ -228,6 +228,26 @@ void skinny128_384_encrypt(u8* ctext, const u8* ptext, const tweakey tk,
 	unpacking(ctext, ctext_bis, state);
 }
 
+/****************************************************************************
+* Encryption of 2 blocks in parallel over 'rounds' rounds, with the round
+* tweakeys given separately for TK1 ('rtk1', see 'precompute_rtk1') and for
+* the key ('rtk2_3', see 'precompute_rtk2_3') to avoid recomputing the latter
+* for each call.
+****************************************************************************/
+void skinny128_encrypt_rtk(u8* ctext, const u8* ptext, u8* ctext_bis,
+					const u8* ptext_bis, const u32* rtk1, const u32* rtk2_3,
+					int rounds) {
+	u32 state[8];
+	u32 rtk[32];
+	packing(state, ptext, ptext_bis);
+	for(int i = 0; i < rounds; i += 4) {
+		for(int j = 0; j < 32; j++)
+			rtk[j] = rtk1[(i%16)*8 + j] ^ rtk2_3[i*8 + j];
+		QUADRUPLE_ROUND(state, rtk);
+	}
+	unpacking(ctext, ctext_bis, state);
+}
+
 /****************************************************************************
 * Decryption of 2 blocks in parallel using SKINNY-128-128
 ****************************************************************************/
@@ -299,3 +319,21 @@ void skinny128_384_decrypt(u8* ptext, const u8* ctext, const tweakey tk,
 	INV_QUADRUPLE_ROUND(state, rtk);
 	unpacking(ptext, ptext_bis, state);
 }
+
+/****************************************************************************
+* Decryption of 2 blocks in parallel over 'rounds' rounds, with the same
+* round tweakeys as 'skinny128_encrypt_rtk'.
+****************************************************************************/
+void skinny128_decrypt_rtk(u8* ptext, const u8* ctext, u8* ptext_bis,
+					const u8* ctext_bis, const u32* rtk1, const u32* rtk2_3,
+					int rounds) {
+	u32 state[8];
+	u32 rtk[32];
+	packing(state, ctext, ctext_bis);
+	for(int i = rounds - 4; i >= 0; i -= 4) {
+		for(int j = 0; j < 32; j++)
+			rtk[j] = rtk1[(i%16)*8 + j] ^ rtk2_3[i*8 + j];
+		INV_QUADRUPLE_ROUND(state, rtk);
+	}
+	unpacking(ptext, ptext_bis, state);
+}
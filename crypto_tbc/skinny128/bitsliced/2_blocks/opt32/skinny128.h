@@ -15,6 +15,12 @@ void skinny128_256_decrypt(u8* ctext, const u8* ptext, const tweakey tk,
 					u8* ctext_bis, const u8* ptext_bis, const tweakey tk_bis);
 void skinny128_384_decrypt(u8* ctext, const u8* ptext, const tweakey tk, 
 					u8* ctext_bis, const u8* ptext_bis, const tweakey tk_bis);
+void skinny128_encrypt_rtk(u8* ctext, const u8* ptext, u8* ctext_bis,
+					const u8* ptext_bis, const u32* rtk1, const u32* rtk2_3,
+					int rounds);
+void skinny128_decrypt_rtk(u8* ptext, const u8* ctext, u8* ptext_bis,
+					const u8* ctext_bis, const u32* rtk1, const u32* rtk2_3,
+					int rounds);
 
 #define SKINNY128_128_ROUNDS	40
 #define SKINNY128_256_ROUNDS	48
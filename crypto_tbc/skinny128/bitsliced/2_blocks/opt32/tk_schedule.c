@@ -679,3 +679,32 @@ void precompute_tk(u32* rtk, const tweakey tk, const tweakey tk_bis,
 			rtk[i*8+j] ^= rconst_32_bs[i*8+j];
 	}
 }
+
+/****************************************************************************
+* Precompute the round tweakeys related to TK2 and TK3 only (i.e. the key),
+* including the round constants, for 2 blocks under the same key.
+* Combined with those of 'precompute_rtk1' by 'skinny128_encrypt_rtk' and
+* 'skinny128_decrypt_rtk', so that they are only computed once per key.
+****************************************************************************/
+void precompute_rtk2_3(u32* rtk, const u8* tk2, const u8* tk3, int rounds) {
+	const u8 zero[16] = {0};
+	memset(rtk, 0x00, 32*rounds);
+	if(rounds > SKINNY128_128_ROUNDS)
+		precompute_lfsr_tk2(rtk, tk2, tk2, rounds);
+	if(rounds > SKINNY128_256_ROUNDS)
+		precompute_lfsr_tk3(rtk, tk3, tk3, rounds);
+	permute_tk(rtk, zero, zero, rounds);
+	for(int i = 0; i < rounds; i++) {			//add all rconsts to TK
+		for(int j = 0; j < 8; j++)
+			rtk[i*8+j] ^= rconst_32_bs[i*8+j];
+	}
+}
+
+/****************************************************************************
+* Precompute the round tweakeys related to TK1 only, for 16 rounds as they
+* repeat afterwards.
+****************************************************************************/
+void precompute_rtk1(u32* rtk1, const u8* tk1, const u8* tk1_bis) {
+	memset(rtk1, 0x00, 32*16);
+	permute_tk(rtk1, tk1, tk1_bis, 16);
+}
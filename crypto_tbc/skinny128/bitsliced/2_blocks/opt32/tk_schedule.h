@@ -16,6 +16,8 @@ void packing(u32* out, const u8* in, const u8* in_bis);
 void unpacking(u8* out, u8* out_bis, u32 *in);
 void precompute_tk(u32* rtk, const tweakey tk, const tweakey tk_bis,
 				int rounds);
+void precompute_rtk2_3(u32* rtk, const u8* tk2, const u8* tk3, int rounds);
+void precompute_rtk1(u32* rtk1, const u8* tk1, const u8* tk1_bis);
 
 #define ROR(x,y) (((x) >> (y)) | ((x) << (32 - (y))))
 
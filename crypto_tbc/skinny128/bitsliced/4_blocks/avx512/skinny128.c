@@ -0,0 +1,237 @@
+/******************************************************************************
+* Constant-time implementation of SKINNY-128 tweakable block ciphers using
+* AVX-512 instructions, processing 4 independent blocks at once.
+* This is the fixsliced implementation from 'bitsliced/1_block/sse' where each
+* 128-bit lane of a ZMM register holds the state of a block, so that it fits
+* bulk processing (e.g. SKINNY-AEAD-M1 or batches of Romulus messages) while
+* keeping the latency of the single-block version.
+* AVX-512 allows to:
+* 	- compute every 'x ^= ~(y | z)' of the Sbox (i.e. 'x ^= y & z' as the
+* 	state is negated) and the bit permutations with 'vpternlogd';
+* 	- compute MixColumns with masked XORs on 32-bit words instead of zeroing
+* 	the unused bytes through the shuffle masks.
+* Requires AVX512F and AVX512BW (e.g. -mavx512f -mavx512bw).
+*
+* @date 	October 2026
+******************************************************************************/
+#include <string.h>
+#include "skinny128.h"
+
+#if !defined(__AVX512F__) || !defined(__AVX512BW__)
+#error "the 4-block AVX-512 implementation requires AVX512F and AVX512BW"
+#endif
+
+// shuffle masks for fixsliced MixColumns (repeated in every 128-bit lane)
+#define MASK_0 	_mm512_set4_epi32(0x80808080, 0x01000302, 0x0a09080b, 0x80808080)
+#define MASK_1 	_mm512_set4_epi32(0x080b0a09, 0x80808080, 0x80808080, 0x80808080)
+#define MASK_2 	_mm512_set4_epi32(0x80808080, 0x80808080, 0x0f0e0d0c, 0x05040706)
+#define MASK_3 	_mm512_set4_epi32(0x80808080, 0x05040706, 0x80808080, 0x80808080)
+#define MASK_4 	_mm512_set4_epi32(0x00030201, 0x80808080, 0x80808080, 0x09080b0a)
+#define MASK_5 	_mm512_set4_epi32(0x80808080, 0x80808080, 0x02010003, 0x80808080)
+#define MASK_6 	_mm512_set4_epi32(0x07060504, 0x0f0e0d0c, 0x80808080, 0x80808080)
+#define MASK_7 	_mm512_set4_epi32(0x80808080, 0x80808080, 0x80808080, 0x0f0e0d0c)
+
+// 32-bit words updated by the XORs of MixColumns (i.e. the non-zero words of
+// the above shuffle masks)
+#define KMASK_0 	((__mmask16)0x6666)
+#define KMASK_1 	((__mmask16)0x8888)
+#define KMASK_2 	((__mmask16)0x3333)
+#define KMASK_3 	((__mmask16)0x4444)
+#define KMASK_4 	((__mmask16)0x9999)
+#define KMASK_5 	((__mmask16)0x2222)
+#define KMASK_6 	((__mmask16)0xcccc)
+#define KMASK_7 	((__mmask16)0x1111)
+
+#define SHL(x, n) 	_mm512_slli_epi32(x, n)
+#define SHR(x, n) 	_mm512_srli_epi32(x, n)
+#define SET1(m) 	_mm512_set1_epi32(m)
+
+// (a & c) | (b & ~c)
+#define BITSELECT(a, b, c) 	_mm512_ternarylogic_epi32(a, b, c, 0xe4)
+
+// ~((a & c) | (b & ~c))
+#define BITSELECT_NOT(a, b, c) 	_mm512_ternarylogic_epi32(a, b, c, 0x1b)
+
+// x ^= a & b & m where 'a' and 'b' are shifted copies of x, that is a
+// 'x ^= ~(y | z)' of the Sbox on the negated state
+#define NOR_XOR(x, a, b, m) ({									\
+	tmp0 	= _mm512_and_si512(a, SET1(m));						\
+	(x) 	= _mm512_ternarylogic_epi32(x, tmp0, b, 0x78);		\
+})
+
+// swap of bits 'lo' and 'lo + d' within every byte, other bits are in 'keep'
+#define SWAP(x, d, lo, keep) 									\
+	((x) = BITSELECT(x, BITSELECT(SHR(x, d), SHL(x, d), SET1(lo)), SET1(keep)))
+
+// permutation to match the inner-fixsliced sbox representation, followed by
+// the NOT of the whole state for Sbox computations
+#define IN_PERMUTATION_NOT(x) ({								\
+	tmp0 	= BITSELECT(SHL(x, 2), SHL(x, 3), SET1(0x0c0c0c0c));\
+	tmp1 	= BITSELECT(SHR(x, 2), SHR(x, 1), SET1(0x03030303));\
+	(x) 	= BITSELECT_NOT(tmp0, tmp1, SET1(0x8c8c8c8c));		\
+})
+
+// inverse permutation of 'IN_PERMUTATION_NOT' (without the NOT)
+#define OUT_PERMUTATION(x) ({									\
+	tmp0 	= BITSELECT(SHL(x, 1), SHL(x, 2), SET1(0xe0e0e0e0));\
+	tmp1 	= BITSELECT(SHR(x, 3), SHR(x, 2), SET1(0x10101010));\
+	(x) 	= BITSELECT(tmp0, tmp1, SET1(0xecececec));			\
+})
+
+// the 4 kinds of NOR/XOR steps of the inner-fixsliced sboxes
+#define STEP_A(x) 	NOR_XOR(x, SHL(x, 2), SHL(x, 1), 0x84848484)
+#define STEP_B(x) 	NOR_XOR(x, SHL(x, 2), SHL(x, 1), 0x48484848)
+#define STEP_C(x) 	NOR_XOR(x, SHR(x, 3), SHR(x, 6), 0x03030303)
+#define STEP_D(x) 	NOR_XOR(x, SHL(x, 2), 						\
+				BITSELECT(SHR(x, 3), SHL(x, 5), SET1(0x10101010)), 0x30303030)
+
+// 1st sbox according to the inner-fixsliced representation
+#define SBOX_0(x) ({											\
+	STEP_A(x);													\
+	STEP_D(x);													\
+	STEP_B(x);													\
+	STEP_C(x);													\
+	SWAP(x, 1, 0x20202020, 0x9f9f9f9f);							\
+})
+
+// 2nd sbox according to the inner-fixsliced representation
+#define SBOX_1(x) ({											\
+	STEP_C(x);													\
+	STEP_A(x);													\
+	STEP_D(x);													\
+	STEP_B(x);													\
+	SWAP(x, 3, 0x10101010, 0x6f6f6f6f);							\
+})
+
+// 3rd sbox according to the inner-fixsliced representation
+#define SBOX_2(x) ({											\
+	STEP_B(x);													\
+	STEP_C(x);													\
+	STEP_A(x);													\
+	STEP_D(x);													\
+	SWAP(x, 1, 0x02020202, 0xf9f9f9f9);							\
+})
+
+// 4th sbox according to the inner-fixsliced representation
+#define SBOX_3(x) ({											\
+	STEP_D(x);													\
+	STEP_B(x);													\
+	STEP_C(x);													\
+	STEP_A(x);													\
+	SWAP(x, 3, 0x01010101, 0xf6f6f6f6);							\
+})
+
+// MixColumns (the row permutation is omitted)
+#define MIXCOLUMNS(x, k0, m0, k1, m1) ({						\
+	(x) = _mm512_mask_xor_epi32(x, k0, x, _mm512_shuffle_epi8(x, m0));	\
+	(x) = _mm512_mask_xor_epi32(x, k1, x, _mm512_shuffle_epi8(x, m1));	\
+})
+
+// Add round tweakey (includes the rconsts and NOTs for the Sbox)
+#define ADDROUNDTWEAKEY(x, rtk) ((x) = _mm512_xor_si512(x, (rtk)))
+
+// Quadruple round routine
+#define QUADRUPLE_ROUND(x, rtk) ({								\
+	SBOX_0(x);													\
+	ADDROUNDTWEAKEY(x, *(rtk));									\
+	MIXCOLUMNS(x, KMASK_0, MASK_0, KMASK_1, MASK_1);			\
+	SBOX_1(x);													\
+	ADDROUNDTWEAKEY(x, *(rtk+1));								\
+	MIXCOLUMNS(x, KMASK_2, MASK_2, KMASK_3, MASK_3);			\
+	SBOX_2(x);													\
+	ADDROUNDTWEAKEY(x, *(rtk+2));								\
+	MIXCOLUMNS(x, KMASK_4, MASK_4, KMASK_5, MASK_5);			\
+	SBOX_3(x);													\
+	ADDROUNDTWEAKEY(x, *(rtk+3));								\
+	MIXCOLUMNS(x, KMASK_6, MASK_6, KMASK_7, MASK_7);			\
+})
+
+/******************************************************************************
+* Core function for SKINNY128 encryption of 4 blocks, 'in' and 'out' pointing
+* to 64 bytes. Block i is encrypted with the round tweakeys in the i-th 128-bit
+* lane of 'rtk' (see 'precompute_rtk_x4').
+******************************************************************************/
+void core_skinny128_enc_x4(uint8_t* out, const uint8_t* in,
+				const __m512i* rtk, int rounds) {
+	__m512i tmp0, tmp1, state = _mm512_loadu_si512((const void*)in);
+	// apply a permutation on the state to enhance Sboxes calculations, and
+	// negate it (then NOT are performed within ARTK operations)
+	IN_PERMUTATION_NOT(state);
+	// core routine relies on quadruple rounds
+	for(int i = 0; i < rounds; i += 4)
+		QUADRUPLE_ROUND(state, rtk+i);
+	// apply a permutation to match the expected output representation
+	OUT_PERMUTATION(state);
+	_mm512_storeu_si512((void*)out, state);
+}
+
+/******************************************************************************
+* Move the round tweakeys of a single block into the j-th 128-bit lane of the
+* 4-block round tweakeys.
+******************************************************************************/
+static void interleave_rtk(__m512i* rtk, const __m128i* rtk_j, int j,
+				int rounds) {
+	for(int i = 0; i < rounds; i++)
+		_mm_storeu_si128((__m128i*)(rtk + i) + j, rtk_j[i]);
+}
+
+/******************************************************************************
+* Precompute the round tweakeys of SKINNY-128 for the 4 tweakeys in 'tk'.
+******************************************************************************/
+void precompute_rtk_x4(__m512i* rtk, const tweakey* tk, int rounds) {
+	__m128i rtk_j[SKINNY128_384_ROUNDS];
+	for(int j = 0; j < 4; j++) {
+		precompute_rtk(rtk_j, tk + j, rounds);
+		interleave_rtk(rtk, rtk_j, j, rounds);
+	}
+	memset(rtk_j, 0x00, sizeof(rtk_j));
+}
+
+/******************************************************************************
+* Precompute the round tweakeys of SKINNY-128-384+ for the 4 tweakeys in 'tk'.
+******************************************************************************/
+void precompute_rtk_plus_x4(__m512i* rtk, const tweakey* tk) {
+	__m128i rtk_j[SKINNY128_384_PLUS_ROUNDS];
+	for(int j = 0; j < 4; j++) {
+		precompute_rtk_plus(rtk_j, tk + j);
+		interleave_rtk(rtk, rtk_j, j, SKINNY128_384_PLUS_ROUNDS);
+	}
+	memset(rtk_j, 0x00, sizeof(rtk_j));
+}
+
+/******************************************************************************
+* Encryption of 4 blocks using SKINNY-128-128 without any operation mode.
+******************************************************************************/
+void skinny128_128_enc_x4(uint8_t* out, const uint8_t* in, const tweakey* tk) {
+	__m512i rtk[SKINNY128_128_ROUNDS];
+	precompute_rtk_x4(rtk, tk, SKINNY128_128_ROUNDS);
+	core_skinny128_enc_x4(out, in, rtk, SKINNY128_128_ROUNDS);
+}
+
+/******************************************************************************
+* Encryption of 4 blocks using SKINNY-128-256 without any operation mode.
+******************************************************************************/
+void skinny128_256_enc_x4(uint8_t* out, const uint8_t* in, const tweakey* tk) {
+	__m512i rtk[SKINNY128_256_ROUNDS];
+	precompute_rtk_x4(rtk, tk, SKINNY128_256_ROUNDS);
+	core_skinny128_enc_x4(out, in, rtk, SKINNY128_256_ROUNDS);
+}
+
+/******************************************************************************
+* Encryption of 4 blocks using SKINNY-128-384 without any operation mode.
+******************************************************************************/
+void skinny128_384_enc_x4(uint8_t* out, const uint8_t* in, const tweakey* tk) {
+	__m512i rtk[SKINNY128_384_ROUNDS];
+	precompute_rtk_x4(rtk, tk, SKINNY128_384_ROUNDS);
+	core_skinny128_enc_x4(out, in, rtk, SKINNY128_384_ROUNDS);
+}
+
+/******************************************************************************
+* Encryption of 4 blocks using SKINNY-128-384+ without any operation mode.
+******************************************************************************/
+void skinny128_384_plus_enc_x4(uint8_t* out, const uint8_t* in,
+				const tweakey* tk) {
+	__m512i rtk[SKINNY128_384_PLUS_ROUNDS];
+	precompute_rtk_plus_x4(rtk, tk);
+	core_skinny128_enc_x4(out, in, rtk, SKINNY128_384_PLUS_ROUNDS);
+}
@@ -0,0 +1,22 @@
+#ifndef SKINNY128_H_
+#define SKINNY128_H_
+
+#include "tk_schedule.h"
+
+#define SKINNY128_128_ROUNDS 		40
+#define SKINNY128_256_ROUNDS 		48
+#define SKINNY128_384_ROUNDS 		56
+#define SKINNY128_384_PLUS_ROUNDS 	SKINNY128_128_ROUNDS
+
+// 'tk' points to 4 tweakeys, 'in' and 'out' to 4 consecutive blocks
+void precompute_rtk_x4(__m512i* rtk, const tweakey* tk, int rounds);
+void precompute_rtk_plus_x4(__m512i* rtk, const tweakey* tk);
+void core_skinny128_enc_x4(uint8_t* out, const uint8_t* in,
+				const __m512i* rtk, int rounds);
+void skinny128_128_enc_x4(uint8_t* out, const uint8_t* in, const tweakey* tk);
+void skinny128_256_enc_x4(uint8_t* out, const uint8_t* in, const tweakey* tk);
+void skinny128_384_enc_x4(uint8_t* out, const uint8_t* in, const tweakey* tk);
+void skinny128_384_plus_enc_x4(uint8_t* out, const uint8_t* in,
+				const tweakey* tk);
+
+#endif  // SKINNY128_H_
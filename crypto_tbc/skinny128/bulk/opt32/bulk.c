@@ -0,0 +1,53 @@
+/******************************************************************************
+* Bulk Skinny-128-384 encryption/decryption (see 'skinny128_bulk.h') on top of
+* the 2-block fixsliced kernel of SKINNY-AEAD-M1.
+*
+* The TK2/TK3 round tweakeys are precomputed once per key, so that only the
+* TK1 ones (16 rounds, as they repeat afterwards) are computed for each pair of
+* blocks. An odd last block is processed alongside a copy of itself.
+*
+* @date		October 2026
+******************************************************************************/
+#include "skinny128_bulk.h"
+#include "skinny128.h"
+#include <string.h>
+
+#define BLOCKBYTES		16
+
+void skinny128_384_key_setup(skinny128_384_key *ctx, const unsigned char *k) {
+	precompute_rtk2_3(ctx->rtk_23, k, k + 16, SKINNY128_384_ROUNDS);
+}
+
+void skinny128_384_encrypt_many(unsigned char *out, const unsigned char *in,
+			const unsigned char *tweaks, size_t n, const skinny128_384_key *ctx) {
+	tweakey tk;
+	memcpy(tk.rtk2_3, ctx->rtk_23, sizeof(tk.rtk2_3));
+	for(; n >= 2; n -= 2) {
+		precompute_rtk1(tk.rtk1, tweaks, tweaks + BLOCKBYTES);
+		skinny128_384_encrypt(out, out + BLOCKBYTES, in, in + BLOCKBYTES, tk);
+		in += 2*BLOCKBYTES;
+		out += 2*BLOCKBYTES;
+		tweaks += 2*BLOCKBYTES;
+	}
+	if (n) {
+		precompute_rtk1(tk.rtk1, tweaks, tweaks);
+		skinny128_384_encrypt(out, out, in, in, tk);
+	}
+}
+
+void skinny128_384_decrypt_many(unsigned char *out, const unsigned char *in,
+			const unsigned char *tweaks, size_t n, const skinny128_384_key *ctx) {
+	tweakey tk;
+	memcpy(tk.rtk2_3, ctx->rtk_23, sizeof(tk.rtk2_3));
+	for(; n >= 2; n -= 2) {
+		precompute_rtk1(tk.rtk1, tweaks, tweaks + BLOCKBYTES);
+		skinny128_384_decrypt(out, out + BLOCKBYTES, in, in + BLOCKBYTES, tk);
+		in += 2*BLOCKBYTES;
+		out += 2*BLOCKBYTES;
+		tweaks += 2*BLOCKBYTES;
+	}
+	if (n) {
+		precompute_rtk1(tk.rtk1, tweaks, tweaks);
+		skinny128_384_decrypt(out, out, in, in, tk);
+	}
+}
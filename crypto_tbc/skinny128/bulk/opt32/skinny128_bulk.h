@@ -0,0 +1,54 @@
+/**
+ * Bulk interface of Skinny-128-384: encryption/decryption of arrays of
+ * independent (tweak, block) pairs under a single key.
+ * 
+ * The 384-bit tweakey is split into a 128-bit tweak (TK1), which may differ
+ * for each block, and a 256-bit key (TK2 || TK3), whose round tweakeys are
+ * precomputed once by 'skinny128_384_key_setup'. Each backend then processes
+ * the blocks with its widest multi-block kernel:
+ *  - 'opt32': 2 blocks at a time (fixsliced, 'skinnyaead-m1/2_blocks/opt32');
+ *  - 'x86': byte-wise SSSE3, with the instructions of 3 blocks interleaved
+ *    for encryption, or 2 blocks per YMM register when compiled with AVX2.
+ * 
+ * @date        October 2026
+ */
+#ifndef SKINNY128_BULK_H_
+#define SKINNY128_BULK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SKINNY128_384_KEYBYTES      32  // TK2 || TK3
+#define SKINNY128_384_TWEAKBYTES    16  // TK1
+
+// Round tweakeys of TK2/TK3 for the 56 rounds, in the layout of the backend
+typedef struct {
+    uint32_t rtk_23[8*56];
+} skinny128_384_key;
+
+/**
+ * Precompute the round tweakeys related to the 32-byte key 'k' (TK2 || TK3).
+ */
+void skinny128_384_key_setup(
+    skinny128_384_key *ctx,
+    const unsigned char *k);
+
+/**
+ * Encrypt (resp. decrypt) the 'n' 16-byte blocks of 'in' into 'out' (which may
+ * be 'in'), block i being processed under the 16-byte tweak 'tweaks + 16*i'.
+ */
+void skinny128_384_encrypt_many(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tweaks,
+    size_t n,
+    const skinny128_384_key *ctx);
+
+void skinny128_384_decrypt_many(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tweaks,
+    size_t n,
+    const skinny128_384_key *ctx);
+
+#endif  // SKINNY128_BULK_H_
@@ -0,0 +1 @@
+../../stats/skinny_stats.c
\ No newline at end of file
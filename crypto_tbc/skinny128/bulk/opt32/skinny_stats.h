@@ -0,0 +1 @@
+../../stats/skinny_stats.h
\ No newline at end of file
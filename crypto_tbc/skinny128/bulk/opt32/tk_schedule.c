@@ -0,0 +1 @@
+../../../../crypto_aead/skinnyaead-m1/2_blocks/opt32/tk_schedule.c
\ No newline at end of file
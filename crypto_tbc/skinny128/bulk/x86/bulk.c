@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Bulk Skinny-128-384 encryption/decryption (see 'skinny128_bulk.h') on top of
+ * the byte-wise kernels of 'crypto_tbc/skinny128/simd/x86'.
+ * 
+ * The TK2/TK3 round tweakeys are precomputed once per key by 'tk_schedule_384'
+ * and shared by all the blocks, whose TK1 round tweakeys are computed by the
+ * kernels themselves. Blocks are processed 2 at a time in YMM registers when
+ * compiled with AVX2. Otherwise, encryption interleaves the instructions of 3
+ * blocks while decryption is done block by block.
+ * 
+ * @date        October 2026
+ *****************************************************************************/
+#include "skinny128_bulk.h"
+#include "skinny128.h"
+
+void skinny128_384_key_setup(
+    skinny128_384_key *ctx,
+    const unsigned char *k)
+{
+    tk_schedule_384((unsigned char *)ctx->rtk_23, k, k + TWEAKEYBYTES);
+}
+
+void skinny128_384_encrypt_many(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tweaks,
+    size_t n,
+    const skinny128_384_key *ctx)
+{
+    const unsigned char *rtk_23 = (const unsigned char *)ctx->rtk_23;
+#if defined(__AVX2__)
+    for(; n >= 2; n -= 2) {
+        skinny128_384_x2(out, in, tweaks, tweaks + TWEAKEYBYTES, rtk_23);
+        in += 2*BLOCKBYTES;
+        out += 2*BLOCKBYTES;
+        tweaks += 2*TWEAKEYBYTES;
+    }
+#else
+    for(; n >= 3; n -= 3) {
+        skinny128_384_x3(out, in, tweaks, rtk_23,
+            out + BLOCKBYTES, in + BLOCKBYTES, tweaks + TWEAKEYBYTES, rtk_23,
+            out + 2*BLOCKBYTES, in + 2*BLOCKBYTES, tweaks + 2*TWEAKEYBYTES,
+            rtk_23);
+        in += 3*BLOCKBYTES;
+        out += 3*BLOCKBYTES;
+        tweaks += 3*TWEAKEYBYTES;
+    }
+#endif
+    for(; n > 0; n--) {
+        skinny128_384(out, in, tweaks, rtk_23);
+        in += BLOCKBYTES;
+        out += BLOCKBYTES;
+        tweaks += TWEAKEYBYTES;
+    }
+}
+
+void skinny128_384_decrypt_many(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tweaks,
+    size_t n,
+    const skinny128_384_key *ctx)
+{
+    const unsigned char *rtk_23 = (const unsigned char *)ctx->rtk_23;
+#if defined(__AVX2__)
+    for(; n >= 2; n -= 2) {
+        skinny128_384_inv_x2(out, in, tweaks, tweaks + TWEAKEYBYTES, rtk_23);
+        in += 2*BLOCKBYTES;
+        out += 2*BLOCKBYTES;
+        tweaks += 2*TWEAKEYBYTES;
+    }
+#endif
+    for(; n > 0; n--) {
+        skinny128_384_inv(out, in, tweaks, rtk_23);
+        in += BLOCKBYTES;
+        out += BLOCKBYTES;
+        tweaks += TWEAKEYBYTES;
+    }
+}
@@ -0,0 +1 @@
+../../simd/x86/skinny128.c
\ No newline at end of file
@@ -0,0 +1 @@
+../opt32/skinny128_bulk.h
\ No newline at end of file
@@ -0,0 +1,80 @@
+/******************************************************************************
+* Sector encryption with Skinny-128-256 (see 'skinny_sector.h') on top of the
+* 2-block fixsliced kernel of 'crypto_tbc/skinny128/bitsliced/2_blocks/opt32'.
+*
+* The TK2 round tweakeys are precomputed once per key, so that only the TK1
+* ones (16 rounds, as they repeat afterwards) are computed for each pair of
+* blocks. An odd last block is processed alongside a copy of itself.
+*
+* @date		October 2026
+******************************************************************************/
+#include "skinny_sector.h"
+#include "skinny128.h"
+
+#define BLOCKBYTES		SKINNY_SECTOR_BLOCKBYTES
+
+/******************************************************************************
+* Tweak of the block 'block' of sector 'sector'.
+******************************************************************************/
+static void sector_tweak(u8* tweak, uint64_t sector, uint64_t block) {
+	for(int i = 0; i < 8; i++) {
+		tweak[i] = (u8)(sector >> (8*i));
+		tweak[8+i] = (u8)(block >> (8*i));
+	}
+}
+
+void skinny_sector_key_setup(skinny_sector_key *ctx, const unsigned char *k) {
+	precompute_rtk2_3(ctx->rtk_2, k, k, SKINNY128_256_ROUNDS);
+}
+
+static int sector_crypt(const skinny_sector_key *ctx, uint64_t sector,
+			uint64_t block, u8* buf, size_t len, int dec) {
+	u32 rtk1[8*16];
+	u8 tweak[2*BLOCKBYTES];
+	if (len % BLOCKBYTES)
+		return -1;
+	for(; len >= 2*BLOCKBYTES; len -= 2*BLOCKBYTES) {
+		sector_tweak(tweak, sector, block);
+		sector_tweak(tweak + BLOCKBYTES, sector, block + 1);
+		precompute_rtk1(rtk1, tweak, tweak + BLOCKBYTES);
+		if (dec)
+			skinny128_decrypt_rtk(buf, buf, buf + BLOCKBYTES, buf + BLOCKBYTES,
+				rtk1, ctx->rtk_2, SKINNY128_256_ROUNDS);
+		else
+			skinny128_encrypt_rtk(buf, buf, buf + BLOCKBYTES, buf + BLOCKBYTES,
+				rtk1, ctx->rtk_2, SKINNY128_256_ROUNDS);
+		buf += 2*BLOCKBYTES;
+		block += 2;
+	}
+	if (len) {
+		sector_tweak(tweak, sector, block);
+		precompute_rtk1(rtk1, tweak, tweak);
+		if (dec)
+			skinny128_decrypt_rtk(buf, buf, buf, buf, rtk1, ctx->rtk_2,
+				SKINNY128_256_ROUNDS);
+		else
+			skinny128_encrypt_rtk(buf, buf, buf, buf, rtk1, ctx->rtk_2,
+				SKINNY128_256_ROUNDS);
+	}
+	return 0;
+}
+
+int skinny_sector_encrypt_at(const skinny_sector_key *ctx, uint64_t sector,
+			uint64_t block, unsigned char *buf, size_t len) {
+	return sector_crypt(ctx, sector, block, buf, len, 0);
+}
+
+int skinny_sector_decrypt_at(const skinny_sector_key *ctx, uint64_t sector,
+			uint64_t block, unsigned char *buf, size_t len) {
+	return sector_crypt(ctx, sector, block, buf, len, 1);
+}
+
+int skinny_sector_encrypt(const skinny_sector_key *ctx, uint64_t sector,
+			unsigned char *buf, size_t len) {
+	return sector_crypt(ctx, sector, 0, buf, len, 0);
+}
+
+int skinny_sector_decrypt(const skinny_sector_key *ctx, uint64_t sector,
+			unsigned char *buf, size_t len) {
+	return sector_crypt(ctx, sector, 0, buf, len, 1);
+}
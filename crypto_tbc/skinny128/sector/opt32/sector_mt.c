@@ -0,0 +1,109 @@
+/**
+ * Multi-threaded sector encryption (see 'skinny_sector.h').
+ * 
+ * The blocks of the extent are split into contiguous ranges of (almost) equal
+ * size, one per thread, each range being processed sector by sector through
+ * 'skinny_sector_encrypt_at'/'skinny_sector_decrypt_at' since it may start or
+ * end in the middle of a sector. The calling thread processes the first range
+ * and, if a thread cannot be created, its range is processed by the calling
+ * thread as well.
+ * 
+ * @date        October 2026
+ */
+#include <pthread.h>
+#include "skinny_sector.h"
+
+typedef struct {
+    const skinny_sector_key *ctx;
+    uint64_t sector;
+    uint64_t blocks_per_sector;
+    uint64_t first;             // first block of the range, within the extent
+    uint64_t last;              // last block of the range (excluded)
+    unsigned char *buf;         // start of the extent
+    int dec;
+    pthread_t th;
+} sector_job;
+
+static void *sector_worker(void *arg)
+{
+    sector_job *j = (sector_job *)arg;
+    uint64_t b, idx, n;
+    for(b = j->first; b < j->last; b += n) {
+        idx = b % j->blocks_per_sector;
+        n = j->blocks_per_sector - idx;
+        if (n > j->last - b)
+            n = j->last - b;
+        if (j->dec)
+            skinny_sector_decrypt_at(j->ctx, j->sector + b / j->blocks_per_sector,
+                idx, j->buf + b*SKINNY_SECTOR_BLOCKBYTES,
+                n*SKINNY_SECTOR_BLOCKBYTES);
+        else
+            skinny_sector_encrypt_at(j->ctx, j->sector + b / j->blocks_per_sector,
+                idx, j->buf + b*SKINNY_SECTOR_BLOCKBYTES,
+                n*SKINNY_SECTOR_BLOCKBYTES);
+    }
+    return NULL;
+}
+
+static int sector_crypt_mt(
+    const skinny_sector_key *ctx,
+    uint64_t sector, size_t sector_size,
+    unsigned char *buf, size_t len,
+    int threads, int dec)
+{
+    sector_job jobs[SKINNY_SECTOR_MT_MAX];
+    int started[SKINNY_SECTOR_MT_MAX];
+    uint64_t nblocks, first;
+    int t;
+
+    if (sector_size == 0 || sector_size % SKINNY_SECTOR_BLOCKBYTES ||
+            len % sector_size)
+        return -1;
+    if (threads > SKINNY_SECTOR_MT_MAX)
+        threads = SKINNY_SECTOR_MT_MAX;
+    if ((size_t)threads > len / SKINNY_SECTOR_MT_MIN)
+        threads = (int)(len / SKINNY_SECTOR_MT_MIN);
+    if (threads < 1)
+        threads = 1;
+
+    nblocks = len / SKINNY_SECTOR_BLOCKBYTES;
+    first = 0;
+    for(t = 0; t < threads; t++) {
+        jobs[t].ctx = ctx;
+        jobs[t].sector = sector;
+        jobs[t].blocks_per_sector = sector_size / SKINNY_SECTOR_BLOCKBYTES;
+        jobs[t].first = first;
+        first += nblocks / threads + ((uint64_t)t < nblocks % threads);
+        jobs[t].last = first;
+        jobs[t].buf = buf;
+        jobs[t].dec = dec;
+    }
+    for(t = 1; t < threads; t++)
+        started[t] = !pthread_create(&jobs[t].th, NULL, sector_worker, &jobs[t]);
+    sector_worker(&jobs[0]);
+    for(t = 1; t < threads; t++) {
+        if (started[t])
+            pthread_join(jobs[t].th, NULL);
+        else
+            sector_worker(&jobs[t]);
+    }
+    return 0;
+}
+
+int skinny_sector_encrypt_mt(
+    const skinny_sector_key *ctx,
+    uint64_t sector, size_t sector_size,
+    unsigned char *buf, size_t len,
+    int threads)
+{
+    return sector_crypt_mt(ctx, sector, sector_size, buf, len, threads, 0);
+}
+
+int skinny_sector_decrypt_mt(
+    const skinny_sector_key *ctx,
+    uint64_t sector, size_t sector_size,
+    unsigned char *buf, size_t len,
+    int threads)
+{
+    return sector_crypt_mt(ctx, sector, sector_size, buf, len, threads, 1);
+}
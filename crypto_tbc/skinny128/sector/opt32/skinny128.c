@@ -0,0 +1 @@
+../../bitsliced/2_blocks/opt32/skinny128.c
\ No newline at end of file
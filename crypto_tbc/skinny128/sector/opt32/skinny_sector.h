@@ -0,0 +1,95 @@
+/**
+ * Sector encryption with Skinny-128-256.
+ * 
+ * Each 16-byte block of a sector (e.g. a disk sector or an object-store page)
+ * is encrypted independently by Skinny-128-256 under the 128-bit key (TK2)
+ * and the tweak (TK1)
+ * 
+ *   sector number (64-bit little-endian) || block index (64-bit little-endian)
+ * 
+ * so that sectors are encrypted in place without expansion and any block may
+ * be processed on its own. As in any tweakable ECB-like mode, there is no
+ * diffusion across blocks and rewriting a block under the same tweak leaks
+ * whether it changed.
+ * 
+ * Blocks are processed with the widest multi-block kernel of the backend, and
+ * large extents made of consecutive sectors can be split over several threads
+ * (see 'skinny_sector_encrypt_mt').
+ * 
+ * @date        October 2026
+ */
+#ifndef SKINNY_SECTOR_H_
+#define SKINNY_SECTOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SKINNY_SECTOR_KEYBYTES      16
+#define SKINNY_SECTOR_BLOCKBYTES    16
+
+// Round tweakeys of TK2 for the 48 rounds, in the layout of the backend
+typedef struct {
+    uint32_t rtk_2[8*48];
+} skinny_sector_key;
+
+/**
+ * Precompute the round tweakeys related to the 16-byte key 'k'.
+ */
+void skinny_sector_key_setup(
+    skinny_sector_key *ctx,
+    const unsigned char *k);
+
+/**
+ * Encrypt (resp. decrypt) in place the 'len' bytes of sector 'sector'.
+ * Returns -1 (and leaves 'buf' untouched) if 'len' is not a multiple of the
+ * block size.
+ */
+int skinny_sector_encrypt(
+    const skinny_sector_key *ctx,
+    uint64_t sector,
+    unsigned char *buf, size_t len);
+
+int skinny_sector_decrypt(
+    const skinny_sector_key *ctx,
+    uint64_t sector,
+    unsigned char *buf, size_t len);
+
+/**
+ * Same as above for the part of sector 'sector' starting at block 'block',
+ * so that a sector can be processed piecewise.
+ */
+int skinny_sector_encrypt_at(
+    const skinny_sector_key *ctx,
+    uint64_t sector, uint64_t block,
+    unsigned char *buf, size_t len);
+
+int skinny_sector_decrypt_at(
+    const skinny_sector_key *ctx,
+    uint64_t sector, uint64_t block,
+    unsigned char *buf, size_t len);
+
+/**
+ * Encrypt (resp. decrypt) in place the extent 'buf' of 'len' bytes, made of
+ * consecutive sectors of 'sector_size' bytes starting at sector 'sector', with
+ * up to 'threads' threads (including the calling one). Fewer threads are used
+ * for small extents, so that each of them gets at least SKINNY_SECTOR_MT_MIN
+ * bytes.
+ * Returns -1 (and leaves 'buf' untouched) if 'sector_size' is not a non-zero
+ * multiple of the block size or 'len' not a multiple of 'sector_size'.
+ */
+#define SKINNY_SECTOR_MT_MIN        (64*1024)
+#define SKINNY_SECTOR_MT_MAX        64
+
+int skinny_sector_encrypt_mt(
+    const skinny_sector_key *ctx,
+    uint64_t sector, size_t sector_size,
+    unsigned char *buf, size_t len,
+    int threads);
+
+int skinny_sector_decrypt_mt(
+    const skinny_sector_key *ctx,
+    uint64_t sector, size_t sector_size,
+    unsigned char *buf, size_t len,
+    int threads);
+
+#endif  // SKINNY_SECTOR_H_
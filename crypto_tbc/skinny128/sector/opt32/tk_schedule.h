@@ -0,0 +1 @@
+../../bitsliced/2_blocks/opt32/tk_schedule.h
\ No newline at end of file
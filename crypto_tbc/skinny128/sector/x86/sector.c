@@ -0,0 +1,117 @@
+/******************************************************************************
+ * Sector encryption with Skinny-128-256 (see 'skinny_sector.h') on top of the
+ * byte-wise kernels of 'crypto_tbc/skinny128/simd/x86'.
+ * 
+ * The TK2 round tweakeys are precomputed once per key by 'tk_schedule_2' and
+ * shared by all the blocks, whose TK1 round tweakeys are computed by the
+ * kernels themselves. Blocks are processed 2 at a time in YMM registers when
+ * compiled with AVX2. Otherwise, encryption interleaves the instructions of 3
+ * blocks while decryption is done block by block.
+ * 
+ * @date        October 2026
+ *****************************************************************************/
+#include "skinny_sector.h"
+#include "skinny128.h"
+
+/**
+ * Tweaks of the 'n' consecutive blocks of sector 'sector' starting at 'block'.
+ */
+static void sector_tweaks(
+    unsigned char *tweaks,
+    uint64_t sector,
+    uint64_t block,
+    int n)
+{
+    int i, j;
+    for(j = 0; j < n; j++, block++, tweaks += TWEAKEYBYTES) {
+        for(i = 0; i < 8; i++) {
+            tweaks[i] = (unsigned char)(sector >> (8*i));
+            tweaks[8+i] = (unsigned char)(block >> (8*i));
+        }
+    }
+}
+
+void skinny_sector_key_setup(
+    skinny_sector_key *ctx,
+    const unsigned char *k)
+{
+    tk_schedule_2((unsigned char *)ctx->rtk_2, k);
+}
+
+int skinny_sector_encrypt_at(
+    const skinny_sector_key *ctx,
+    uint64_t sector, uint64_t block,
+    unsigned char *buf, size_t len)
+{
+    const unsigned char *rtk_2 = (const unsigned char *)ctx->rtk_2;
+    unsigned char tweaks[3*TWEAKEYBYTES];
+    if (len % BLOCKBYTES)
+        return -1;
+#if defined(__AVX2__)
+    for(; len >= 2*BLOCKBYTES; len -= 2*BLOCKBYTES) {
+        sector_tweaks(tweaks, sector, block, 2);
+        skinny128_256_x2(buf, buf, tweaks, tweaks + TWEAKEYBYTES, rtk_2);
+        buf += 2*BLOCKBYTES;
+        block += 2;
+    }
+#else
+    for(; len >= 3*BLOCKBYTES; len -= 3*BLOCKBYTES) {
+        sector_tweaks(tweaks, sector, block, 3);
+        skinny128_256_x3(buf, buf, tweaks, rtk_2,
+            buf + BLOCKBYTES, buf + BLOCKBYTES, tweaks + TWEAKEYBYTES, rtk_2,
+            buf + 2*BLOCKBYTES, buf + 2*BLOCKBYTES, tweaks + 2*TWEAKEYBYTES,
+            rtk_2);
+        buf += 3*BLOCKBYTES;
+        block += 3;
+    }
+#endif
+    for(; len > 0; len -= BLOCKBYTES) {
+        sector_tweaks(tweaks, sector, block, 1);
+        skinny128_256(buf, buf, tweaks, rtk_2);
+        buf += BLOCKBYTES;
+        block++;
+    }
+    return 0;
+}
+
+int skinny_sector_decrypt_at(
+    const skinny_sector_key *ctx,
+    uint64_t sector, uint64_t block,
+    unsigned char *buf, size_t len)
+{
+    const unsigned char *rtk_2 = (const unsigned char *)ctx->rtk_2;
+    unsigned char tweaks[2*TWEAKEYBYTES];
+    if (len % BLOCKBYTES)
+        return -1;
+#if defined(__AVX2__)
+    for(; len >= 2*BLOCKBYTES; len -= 2*BLOCKBYTES) {
+        sector_tweaks(tweaks, sector, block, 2);
+        skinny128_256_inv_x2(buf, buf, tweaks, tweaks + TWEAKEYBYTES, rtk_2);
+        buf += 2*BLOCKBYTES;
+        block += 2;
+    }
+#endif
+    for(; len > 0; len -= BLOCKBYTES) {
+        sector_tweaks(tweaks, sector, block, 1);
+        skinny128_256_inv(buf, buf, tweaks, rtk_2);
+        buf += BLOCKBYTES;
+        block++;
+    }
+    return 0;
+}
+
+int skinny_sector_encrypt(
+    const skinny_sector_key *ctx,
+    uint64_t sector,
+    unsigned char *buf, size_t len)
+{
+    return skinny_sector_encrypt_at(ctx, sector, 0, buf, len);
+}
+
+int skinny_sector_decrypt(
+    const skinny_sector_key *ctx,
+    uint64_t sector,
+    unsigned char *buf, size_t len)
+{
+    return skinny_sector_decrypt_at(ctx, sector, 0, buf, len);
+}
@@ -0,0 +1 @@
+../opt32/sector_mt.c
\ No newline at end of file
@@ -0,0 +1 @@
+../opt32/skinny_sector.h
\ No newline at end of file
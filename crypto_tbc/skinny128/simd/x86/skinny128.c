@@ -1,6 +1,19 @@
 /******************************************************************************
  * Intel SSSE3 Skinny-128-384+ implementation.
  * 
+ * The full 56-round Skinny-128-384 (e.g. for SKINNY-AEAD-M1) is generated from
+ * the same kernel, which also comes with its inverse for both variants.
+ * Skinny-128-128 and Skinny-128-256 are also provided, with either precomputed
+ * or on-the-fly round tweakeys, as well as two-block variants when compiled
+ * with AVX2 support (e.g. '-mavx2').
+ * 
+ * With '-DSKINNY_SBOX_VBMI' (requires AVX-512 VBMI, e.g. '-mavx512vbmi'), the
+ * 8-bit S-box is computed with two 'vpermi2b' lookups into 128-entry tables
+ * instead of four 4-bit lookups. It is not the default since it turned out to
+ * be slower on the whole kernel (see 'bench/kernels.sh'): the 512-bit
+ * permutations have a higher latency and compete with the linear layer for the
+ * shuffle port.
+ * 
  * @author  Alexandre Adomnicai
  *          alex.adomnicai@gmail.com
  * 
@@ -8,6 +21,107 @@
  *****************************************************************************/
 #include "immintrin.h"
 #include "skinny128.h"
+#include "skinny_stats.h"
+
+#if defined(SKINNY_SBOX_VBMI) && !defined(__AVX512VBMI__)
+#error "SKINNY_SBOX_VBMI requires AVX-512 VBMI support (e.g. '-mavx512vbmi')"
+#endif
+
+/**
+ * Vector operations and round tweakey loads of the S-box and linear layer
+ * macros below, redefined for 256-bit registers by the AVX2 kernels at the end
+ * of this file.
+ */
+#define VXOR(a, b)      _mm_xor_si128(a, b)
+#define VAND(a, b)      _mm_and_si128(a, b)
+#define VOR(a, b)       _mm_or_si128(a, b)
+#define VSHUF(a, b)     _mm_shuffle_epi8(a, b)
+#define VSRLI16(a, n)   _mm_srli_epi16(a, n)
+#define LOAD_RTK_1(p)   _mm_loadl_epi64((const __m128i*)(p))
+#define LOAD_RTK_23(p)  _mm_loadl_epi64((const __m128i*)(p))
+
+/**
+ * Apply the S-box to the internal state 'state' through 4-bit lookups.
+ */
+#define SBOX_NIBBLES()                                                          \
+    tmp0  = VSRLI16(state, 4);              /* extract high nibbles (1/2) */    \
+    state = VAND(state, mask_nib);          /* extract low nibbles */           \
+    tmp0  = VAND(tmp0, mask_nib);           /* extract high nibbles (2/2) */    \
+    state = VSHUF(s1, state);               /* apply inner S-box S1 */          \
+    tmp0  = VSHUF(s0, tmp0);                /* apply inner S-box S0 */          \
+    state = VXOR(tmp0, state);              /* recombine S-boxes' outputs */    \
+    tmp0  = VSRLI16(state, 4);              /* extract high nibbles (1/2) */    \
+    tmp1  = VAND(state, mask_lsb);          /* extract LSB */                   \
+    tmp0  = VAND(tmp0, mask_nib);           /* extract high nibbles (2/2) */    \
+    state = VAND(state, mask_nib);          /* extract low nibbles */           \
+    tmp0  = VSHUF(s3, tmp0);                /* apply inner S-box S3 */          \
+    state = VSHUF(s2, state);               /* apply inner S-box S2 */          \
+    tmp0  = VOR(tmp1, tmp0);                /* additional OR with LSB */        \
+    state = VXOR(state, tmp0);              /* recombine S-boxes' outputs */    \
+
+#if defined(SKINNY_SBOX_VBMI)
+/**
+ * Skinny 8-bit S-box, looked up in 2 halves of 128 entries by 'vpermi2b'.
+ */
+static const unsigned char sbox_8[256] __attribute__((aligned(64))) = {
+    0x65, 0x4c, 0x6a, 0x42, 0x4b, 0x63, 0x43, 0x6b, 0x55, 0x75, 0x5a, 0x7a, 0x53, 0x73, 0x5b, 0x7b,
+    0x35, 0x8c, 0x3a, 0x81, 0x89, 0x33, 0x80, 0x3b, 0x95, 0x25, 0x98, 0x2a, 0x90, 0x23, 0x99, 0x2b,
+    0xe5, 0xcc, 0xe8, 0xc1, 0xc9, 0xe0, 0xc0, 0xe9, 0xd5, 0xf5, 0xd8, 0xf8, 0xd0, 0xf0, 0xd9, 0xf9,
+    0xa5, 0x1c, 0xa8, 0x12, 0x1b, 0xa0, 0x13, 0xa9, 0x05, 0xb5, 0x0a, 0xb8, 0x03, 0xb0, 0x0b, 0xb9,
+    0x32, 0x88, 0x3c, 0x85, 0x8d, 0x34, 0x84, 0x3d, 0x91, 0x22, 0x9c, 0x2c, 0x94, 0x24, 0x9d, 0x2d,
+    0x62, 0x4a, 0x6c, 0x45, 0x4d, 0x64, 0x44, 0x6d, 0x52, 0x72, 0x5c, 0x7c, 0x54, 0x74, 0x5d, 0x7d,
+    0xa1, 0x1a, 0xac, 0x15, 0x1d, 0xa4, 0x14, 0xad, 0x02, 0xb1, 0x0c, 0xbc, 0x04, 0xb4, 0x0d, 0xbd,
+    0xe1, 0xc8, 0xec, 0xc5, 0xcd, 0xe4, 0xc4, 0xed, 0xd1, 0xf1, 0xdc, 0xfc, 0xd4, 0xf4, 0xdd, 0xfd,
+    0x36, 0x8e, 0x38, 0x82, 0x8b, 0x30, 0x83, 0x39, 0x96, 0x26, 0x9a, 0x28, 0x93, 0x20, 0x9b, 0x29,
+    0x66, 0x4e, 0x68, 0x41, 0x49, 0x60, 0x40, 0x69, 0x56, 0x76, 0x58, 0x78, 0x50, 0x70, 0x59, 0x79,
+    0xa6, 0x1e, 0xaa, 0x11, 0x19, 0xa3, 0x10, 0xab, 0x06, 0xb6, 0x08, 0xba, 0x00, 0xb3, 0x09, 0xbb,
+    0xe6, 0xce, 0xea, 0xc2, 0xcb, 0xe3, 0xc3, 0xeb, 0xd6, 0xf6, 0xda, 0xfa, 0xd3, 0xf3, 0xdb, 0xfb,
+    0x31, 0x8a, 0x3e, 0x86, 0x8f, 0x37, 0x87, 0x3f, 0x92, 0x21, 0x9e, 0x2e, 0x97, 0x27, 0x9f, 0x2f,
+    0x61, 0x48, 0x6e, 0x46, 0x4f, 0x67, 0x47, 0x6f, 0x51, 0x71, 0x5e, 0x7e, 0x57, 0x77, 0x5f, 0x7f,
+    0xa2, 0x18, 0xae, 0x16, 0x1f, 0xa7, 0x17, 0xaf, 0x01, 0xb2, 0x0e, 0xbe, 0x07, 0xb7, 0x0f, 0xbf,
+    0xe2, 0xca, 0xee, 0xc6, 0xcf, 0xe7, 0xc7, 0xef, 0xd2, 0xf2, 0xde, 0xfe, 0xd7, 0xf7, 0xdf, 0xff
+};
+
+#define SBOX_CONSTANTS                                                          \
+    __m512i sb_0 = _mm512_load_si512((const void*)(sbox_8));                    \
+    __m512i sb_1 = _mm512_load_si512((const void*)(sbox_8+64));                 \
+    __m512i sb_2 = _mm512_load_si512((const void*)(sbox_8+128));                \
+    __m512i sb_3 = _mm512_load_si512((const void*)(sbox_8+192));                \
+
+/**
+ * Apply the S-box to the 16 bytes of 'x': the 7 LSBs of each byte index both
+ * 128-entry tables, the MSB selects which of the two results is kept (through
+ * 'pblendvb' rather than a mask register, whose round-trip is slower).
+ */
+static inline __m128i sbox_vbmi(
+    __m128i x,
+    __m512i sb_0, __m512i sb_1, __m512i sb_2, __m512i sb_3)
+{
+    __m512i idx = _mm512_castsi128_si512(x);
+    __m512i lo  = _mm512_permutex2var_epi8(sb_0, idx, sb_1);
+    __m512i hi  = _mm512_permutex2var_epi8(sb_2, idx, sb_3);
+    return _mm_blendv_epi8(_mm512_castsi512_si128(lo),
+        _mm512_castsi512_si128(hi), x);
+}
+
+/**
+ * Apply the S-box to the internal state 'state'.
+ */
+#define SBOX()                                                                  \
+    state = sbox_vbmi(state, sb_0, sb_1, sb_2, sb_3);                           \
+
+#else
+#define SBOX_CONSTANTS                                                          \
+    __m128i s0 = {0xb090a08010300020, 0xb898a88838182808};                      \
+    __m128i s1 = {0x45044405004181c0, 0x470746064303c282};                      \
+    __m128i s2 = {0x1810080019110901, 0x1a130a031b120b02};                      \
+    __m128i s3 = {0xe063a033c0431380, 0xe464a434c4441484};                      \
+    __m128i mask_nib = {0x0f0f0f0f0f0f0f0f, 0x0f0f0f0f0f0f0f0f};                \
+    __m128i mask_lsb = {0x0101010101010101, 0x0101010101010101};                \
+
+#define SBOX()      SBOX_NIBBLES()
+
+#endif
 
 /**
  * Apply the S-box, Add Round Tweakey, and Add Round Constants to the internal
@@ -15,39 +129,27 @@
  * The half of the TK1 which is added is non-null.
  */ 
 #define SBOX_ARK(rtk_1, rtk_23)                                                 \
-    rtk   = _mm_loadl_epi64((const __m128i*)(rtk_23)); /* load roundtweakey */  \
-    tmp0  = _mm_srli_epi16(state, 4);       /* extract high nibbles (1/2) */    \
-    state = _mm_and_si128(state, mask_nib); /* extract low nibbles */           \
-    tmp0  = _mm_and_si128(tmp0, mask_nib);  /* extract high nibbles (2/2) */    \
-    state = _mm_shuffle_epi8(s1, state);    /* apply inner S-box S1 */          \
-    tmp0  = _mm_shuffle_epi8(s0, tmp0);     /* apply inner S-box S0 */          \
-    rtk   = _mm_xor_si128(rtk, c2);         /* add rconst c2 */                 \
-    state = _mm_xor_si128(tmp0, state);     /* recombine S-boxes' outputs */    \
-    tk_1  = _mm_loadl_epi64((const __m128i*)(rtk_1)); /* load roundtweakey */   \
-    tmp0  = _mm_srli_epi16(state, 4);       /* extract high nibbles (1/2) */    \
-    tmp1  = _mm_and_si128(state, mask_lsb); /* extract LSB */                   \
-    tmp0  = _mm_and_si128(tmp0, mask_nib);  /* extract high nibbles (2/2) */    \
-    state = _mm_and_si128(state, mask_nib); /* extract low nibbles */           \
-    tmp0  = _mm_shuffle_epi8(s3, tmp0);     /* apply inner S-box S3 */          \
-    state = _mm_shuffle_epi8(s2, state);    /* apply inner S-box S2 */          \
-    tmp0  = _mm_or_si128(tmp1, tmp0);       /* additional OR with LSB */        \
-    rtk   = _mm_xor_si128(rtk, tk_1);       /* rtk_123 = rtk_23 ^ rtk_1 */      \
-    state = _mm_xor_si128(state, tmp0);     /* recombine S-boxes' outputs */    \
-    state = _mm_xor_si128(state, rtk);      /* add rtweakey and rconsts */      \
+    rtk   = LOAD_RTK_23(rtk_23);            /* load roundtweakey */             \
+    tk_1  = LOAD_RTK_1(rtk_1);              /* load roundtweakey */             \
+    rtk   = VXOR(rtk, c2);                  /* add rconst c2 */                 \
+    SBOX();                                 /* apply S-box */                   \
+    rtk   = VXOR(rtk, tk_1);                /* rtk_123 = rtk_23 ^ rtk_1 */      \
+    state = VXOR(state, rtk);               /* add rtweakey and rconsts */      \
 
 /**
  * Apply the linear layer (comprising ShiftRows and MixColumns) to the internal
  * state 'state'.
  */
 #define SR_MC()                                                                 \
-    tmp0   = _mm_shuffle_epi8(state, m0);   /* tmp0 <- (r3, r0, r1, r2) */      \
-    tmp1   = _mm_and_si128(state, mask_row);/* tmp1 <- r0, - , - , - ) */       \
-    state = _mm_shuffle_epi8(state, m1);    /* state <- (r2, - , r2, r0) */     \
-    tmp0   = _mm_xor_si128(tmp0, tmp1);     /* (r3^r0, r0, r1, r2) */           \
-    state = _mm_xor_si128(tmp0, state);     /* (r3^r0^r2, r0, r1^r2, r2^r0) */  \
+    tmp0   = VSHUF(state, m0);              /* tmp0 <- (r3, r0, r1, r2) */      \
+    tmp1   = VAND(state, mask_row);         /* tmp1 <- r0, - , - , - ) */       \
+    state = VSHUF(state, m1);               /* state <- (r2, - , r2, r0) */     \
+    tmp0   = VXOR(tmp0, tmp1);              /* (r3^r0, r0, r1, r2) */           \
+    state = VXOR(tmp0, state);              /* (r3^r0^r2, r0, r1^r2, r2^r0) */  \
 
 /**
- * Apply 2 rounds of Skinny-128-384+ to the internal state 'state'.
+ * Apply 2 rounds of Skinny-128-384(+) (or Skinny-128-256 with 'tk_schedule_2')
+ * to the internal state 'state'.
  */
 #define DOUBLE_ROUND(rtk_1, rtk_23)     \
     SBOX_ARK(rtk_1, rtk_23);            \
@@ -56,40 +158,16 @@
     SR_MC();                            \
 
 /**
- * Skinny-128-384+ encryption of a single 128-bit block w/o any operation mode.
- * 
- * The round tweakeys are assumed to be precompute for TK2 and TK3 tweakey
- * states while it is computed on-the-fly for TK1 (which changes for each call
- * to Skinny in Romulus-N/M).
+ * Precompute the round tweakeys related to TK1 for 16 consecutive rounds (the
+ * TK1 permutation has order 16), only the half which is added being stored.
  */
-void skinny128_384_plus(
-    unsigned char *out,
-    const unsigned char *in,
-    const unsigned char *tk1,
-    const unsigned char *rtk_23)
+static inline void precompute_rtk_1(
+    unsigned char *rtk_1,
+    const unsigned char *tk1)
 {
+    __m128i tk_1    = _mm_loadu_si128((const __m128i*)tk1);
+    __m128i perm_tk = {0x0304060205000701, 0x0b0c0e0a0d080f09};
 
-    unsigned char rtk_1[BLOCKBYTES/2*16];
-
-    // use 16 XMM registers to avoid stack usage
-    __m128i tmp0;
-    __m128i tmp1;
-    __m128i rtk;
-    __m128i state = _mm_loadu_si128((const __m128i*)in);
-    __m128i tk_1  = _mm_loadu_si128((const __m128i*)tk1);
-    __m128i s0 = {0xb090a08010300020, 0xb898a88838182808};
-    __m128i s1 = {0x45044405004181c0, 0x470746064303c282};
-    __m128i s2 = {0x1810080019110901, 0x1a130a031b120b02};
-    __m128i s3 = {0xe063a033c0431380, 0xe464a434c4441484};
-    __m128i m0 = {0x030201000c0f0e0d, 0x09080b0a06050407};
-    __m128i m1 = {0x8080808009080b0a, 0x0302010009080b0a};
-    __m128i c2 = {0x0000000000000000,0x0000000000000002};
-    __m128i mask_row = {0x00000000ffffffff, 0x0000000000000000};
-    __m128i mask_nib = {0x0f0f0f0f0f0f0f0f, 0x0f0f0f0f0f0f0f0f};
-    __m128i mask_lsb = {0x0101010101010101, 0x0101010101010101};
-    __m128i perm_tk  = {0x0304060205000701, 0x0b0c0e0a0d080f09};
-
-    // put internal state into output buffer
     _mm_storeu_si64((__m128i*)rtk_1, tk_1);
     tk_1 = _mm_shuffle_epi8(tk_1, _mm_set_epi32(0x03040602, 0x05000701, 0x0b0c0e0a, 0x0d080f09));
     _mm_storeu_si128((__m128i*)(rtk_1+8), tk_1);
@@ -107,39 +185,471 @@ void skinny128_384_plus(
     _mm_storeu_si128((__m128i*)(rtk_1+104), tk_1);
     tk_1 = _mm_shuffle_epi8(tk_1, perm_tk);
     _mm_storeu_si64((__m128i*)(rtk_1+120), tk_1);
+}
 
-    // skinny-128-384+ has 40 rounds
-    DOUBLE_ROUND(rtk_1,     rtk_23);
-    DOUBLE_ROUND(rtk_1+16,  rtk_23+16);
-    DOUBLE_ROUND(rtk_1+32,  rtk_23+32);
-    DOUBLE_ROUND(rtk_1+48,  rtk_23+48);
-    DOUBLE_ROUND(rtk_1+64,  rtk_23+64);
-    DOUBLE_ROUND(rtk_1+80,  rtk_23+80);
-    DOUBLE_ROUND(rtk_1+96,  rtk_23+96);
-    DOUBLE_ROUND(rtk_1+112, rtk_23+112);
-    DOUBLE_ROUND(rtk_1,     rtk_23+128);
-    DOUBLE_ROUND(rtk_1+16,  rtk_23+144);
-    DOUBLE_ROUND(rtk_1+32,  rtk_23+160);
-    DOUBLE_ROUND(rtk_1+48,  rtk_23+176);
-    DOUBLE_ROUND(rtk_1+64,  rtk_23+192);
-    DOUBLE_ROUND(rtk_1+80,  rtk_23+208);
-    DOUBLE_ROUND(rtk_1+96,  rtk_23+224);
-    DOUBLE_ROUND(rtk_1+112, rtk_23+240);
-    DOUBLE_ROUND(rtk_1,     rtk_23+256);
-    DOUBLE_ROUND(rtk_1+16,  rtk_23+272);
-    DOUBLE_ROUND(rtk_1+32,  rtk_23+288);
-    DOUBLE_ROUND(rtk_1+48,  rtk_23+304);
+/**
+ * Skinny-128-384 encryption of a single 128-bit block w/o any operation mode,
+ * over 'rounds' rounds (i.e. 40 for Skinny-128-384+ or 56 for Skinny-128-384).
+ * 
+ * The round tweakeys are assumed to be precomputed for TK2 and TK3 tweakey
+ * states while it is computed on-the-fly for TK1 (which changes for each call
+ * to Skinny in Romulus-N/M or SKINNY-AEAD).
+ * Always inlined with a constant 'rounds' so that each variant below is
+ * compiled into its own kernel.
+ */
+static inline __attribute__((always_inline)) void skinny128_384_x(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1,
+    const unsigned char *rtk_23,
+    const int rounds)
+{
+    int i;
+    unsigned char rtk_1[BLOCKBYTES/2*16];
+
+    // use 16 XMM registers to avoid stack usage
+    __m128i tmp0;
+    __m128i tmp1;
+    __m128i rtk;
+    __m128i tk_1;
+    __m128i state = _mm_loadu_si128((const __m128i*)in);
+    __m128i m0 = {0x030201000c0f0e0d, 0x09080b0a06050407};
+    __m128i m1 = {0x8080808009080b0a, 0x0302010009080b0a};
+    __m128i c2 = {0x0000000000000000,0x0000000000000002};
+    __m128i mask_row = {0x00000000ffffffff, 0x0000000000000000};
+    SBOX_CONSTANTS;
+
+    precompute_rtk_1(rtk_1, tk1);
+
+    // the TK1 round tweakeys repeat every 16 rounds
+    for(i = 0; i < rounds*8; i += 16) {
+        DOUBLE_ROUND(rtk_1 + (i & 127), rtk_23 + i);
+    }
 
     // put internal state into output buffer
     _mm_storeu_si128((__m128i*)out, state);
 }
 
+/**
+ * Skinny-128-384+ encryption of a single 128-bit block w/o any operation mode,
+ * with the round tweakeys for TK2 and TK3 precomputed by 'tk_schedule_23'.
+ */
+void skinny128_384_plus(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1,
+    const unsigned char *rtk_23)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 1);
+    skinny128_384_x(out, in, tk1, rtk_23, SKINNY128_384_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+
+/**
+ * Skinny-128-384 encryption of a single 128-bit block w/o any operation mode,
+ * with the round tweakeys for TK2 and TK3 precomputed by 'tk_schedule_384'.
+ */
+void skinny128_384(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1,
+    const unsigned char *rtk_23)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 1);
+    skinny128_384_x(out, in, tk1, rtk_23, SKINNY128_384_FULL_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+
+/**
+ * Inverse S-box constants. Like the S-box, its inverse is computed through
+ * 4-bit lookups, in three stages since it does not split in two: the first and
+ * last ones are sums of two lookups, the second one needs an additional OR with
+ * the bit 6 of its input (in the same way as the last stage of the S-box).
+ * The intermediate values are not in the natural bit order, which is taken into
+ * account in the tables.
+ */
+#define INV_SBOX_CONSTANTS                                                      \
+    __m128i is0 = {0x0a0e02060c080400, 0x1a1e1216181c1014};                     \
+    __m128i is1 = {0x6525246445050444, 0xe5a5e4a4c585c484};                     \
+    __m128i is2 = {0x062646e6426202a2, 0x042444e4002040e0};                     \
+    __m128i is3 = {0xfa7aca4ab0308000, 0xfb7beb6bf373e363};                     \
+    __m128i is4 = {0x6070405030201000, 0xe0f0c0d0a0b08090};                     \
+    __m128i is5 = {0x1716151412131011, 0x1f1e1d1c1b1a1918};                     \
+    __m128i mask_nib = {0x0f0f0f0f0f0f0f0f, 0x0f0f0f0f0f0f0f0f};                \
+    __m128i mask_b6  = {0x4040404040404040, 0x4040404040404040};                \
+
+/**
+ * Apply the inverse S-box to the internal state 'state'.
+ */
+#define INV_SBOX()                                                              \
+    tmp0  = VSRLI16(state, 4);              /* extract high nibbles (1/2) */    \
+    state = VAND(state, mask_nib);          /* extract low nibbles */           \
+    tmp0  = VAND(tmp0, mask_nib);           /* extract high nibbles (2/2) */    \
+    state = VSHUF(is1, state);              /* 1st stage, low nibbles */        \
+    tmp0  = VSHUF(is0, tmp0);               /* 1st stage, high nibbles */       \
+    state = VXOR(tmp0, state);              /* recombine 1st stage */           \
+    tmp0  = VSRLI16(state, 4);              /* extract high nibbles (1/2) */    \
+    tmp1  = VAND(state, mask_b6);           /* extract bit 6 */                 \
+    tmp0  = VAND(tmp0, mask_nib);           /* extract high nibbles (2/2) */    \
+    state = VAND(state, mask_nib);          /* extract low nibbles */           \
+    tmp0  = VSHUF(is2, tmp0);               /* 2nd stage, high nibbles */       \
+    state = VSHUF(is3, state);              /* 2nd stage, low nibbles */        \
+    state = VOR(state, tmp1);               /* additional OR with bit 6 */      \
+    state = VXOR(tmp0, state);              /* recombine 2nd stage */           \
+    tmp0  = VSRLI16(state, 4);              /* extract high nibbles (1/2) */    \
+    state = VAND(state, mask_nib);          /* extract low nibbles */           \
+    tmp0  = VAND(tmp0, mask_nib);           /* extract high nibbles (2/2) */    \
+    state = VSHUF(is5, state);              /* 3rd stage, low nibbles */        \
+    tmp0  = VSHUF(is4, tmp0);               /* 3rd stage, high nibbles */       \
+    state = VXOR(tmp0, state);              /* recombine 3rd stage */           \
+
+/**
+ * Apply the inverse linear layer (i.e. inverse MixColumns and inverse
+ * ShiftRows) to the internal state 'state'.
+ */
+#define INV_SR_MC()                                                             \
+    tmp0  = VSHUF(state, im0);              /* (r1, r1, r1, r0) */              \
+    tmp1  = VSHUF(state, im1);              /* ( -, r2, r3, r3) */              \
+    state = VSHUF(state, im2);              /* ( -, r3, - , - ) */              \
+    tmp0  = VXOR(tmp0, tmp1);                                                   \
+    state = VXOR(state, tmp0);              /* (r1, r1^r2^r3, r1^r3, r0^r3) */  \
+
+/**
+ * Apply the inverse of a round to the internal state 'state'.
+ */
+#define INV_ROUND(rtk_1, rtk_23)                                                \
+    INV_SR_MC();                            /* inverse linear layer */          \
+    rtk   = LOAD_RTK_23(rtk_23);                                                \
+    tk_1  = LOAD_RTK_1(rtk_1);                                                  \
+    rtk   = VXOR(rtk, c2);                  /* add rconst c2 */                 \
+    rtk   = VXOR(rtk, tk_1);                /* rtk_123 = rtk_23 ^ rtk_1 */      \
+    state = VXOR(state, rtk);               /* add rtweakey and rconsts */      \
+    INV_SBOX();                             /* apply inverse S-box */           \
+
+/**
+ * Skinny-128-384 decryption of a single 128-bit block w/o any operation mode,
+ * over 'rounds' rounds, with the same round tweakeys as 'skinny128_384_x'
+ * processed in reverse order (also Skinny-128-256 with 'tk_schedule_2').
+ */
+static inline __attribute__((always_inline)) void skinny128_384_inv_x(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1,
+    const unsigned char *rtk_23,
+    const int rounds)
+{
+    int i;
+    unsigned char rtk_1[BLOCKBYTES/2*16];
+    __m128i tmp0;
+    __m128i tmp1;
+    __m128i rtk;
+    __m128i tk_1;
+    __m128i state = _mm_loadu_si128((const __m128i*)in);
+    __m128i im0 = {0x0407060507060504, 0x0201000305040706};
+    __m128i im1 = {0x080b0a0980808080, 0x0e0d0c0f0d0c0f0e};
+    __m128i im2 = {0x0c0f0e0d80808080, 0x8080808080808080};
+    __m128i c2 = {0x0000000000000000,0x0000000000000002};
+    INV_SBOX_CONSTANTS;
+
+    precompute_rtk_1(rtk_1, tk1);
+
+    for(i = rounds - 1; i >= 0; i--) {
+        INV_ROUND(rtk_1 + 8*(i & 15), rtk_23 + 8*i);
+    }
+
+    _mm_storeu_si128((__m128i*)out, state);
+}
+
+/**
+ * Skinny-128-384+ decryption of a single 128-bit block w/o any operation mode,
+ * with the round tweakeys for TK2 and TK3 precomputed by 'tk_schedule_23'.
+ */
+void skinny128_384_plus_inv(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1,
+    const unsigned char *rtk_23)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY_INV, 1);
+    skinny128_384_inv_x(out, in, tk1, rtk_23, SKINNY128_384_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY_INV);
+}
+
+/**
+ * Skinny-128-384 decryption of a single 128-bit block w/o any operation mode,
+ * with the round tweakeys for TK2 and TK3 precomputed by 'tk_schedule_384'.
+ */
+void skinny128_384_inv(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1,
+    const unsigned char *rtk_23)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY_INV, 1);
+    skinny128_384_inv_x(out, in, tk1, rtk_23, SKINNY128_384_FULL_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY_INV);
+}
+
+/******************************************************************************
+ * Multi-chain kernels: 2 or 3 independent blocks, each with its own TK1 and
+ * TK2/TK3 round tweakeys, are processed round by round with their instructions
+ * interleaved, so that the dependency chain of one block fills the issue slots
+ * left unused by the others.
+ * 
+ * Each step below is the sequence of instructions of 'SBOX_ARK' or 'SR_MC' for
+ * lane 'j', and LANES_X2/LANES_X3 emit a step for every lane before moving on
+ * to the next one. Variables of lane 'j' are suffixed by '_j'.
+ *****************************************************************************/
+#define LANES_X2(step, r1, r23)     step(0, r1, r23) step(1, r1, r23)
+#define LANES_X3(step, r1, r23)     step(0, r1, r23) step(1, r1, r23)        \
+                                    step(2, r1, r23)
+
+#if defined(SKINNY_SBOX_VBMI)
+#define STEP_SB01_IN(j, r1, r23)                                                \
+    rk_##j    = _mm_loadl_epi64((const __m128i*)(rtk_23_##j + (r23)));          \
+    tk_1_##j  = _mm_loadl_epi64((const __m128i*)(rtk_1_##j + (r1)));            \
+    rk_##j    = _mm_xor_si128(rk_##j, c2);                                      \
+
+#define STEP_SB01_OUT(j, r1, r23)                                               \
+    state_##j = sbox_vbmi(state_##j, sb_0, sb_1, sb_2, sb_3);                   \
+
+#define STEP_SB23_IN(j, r1, r23)                                                \
+    rk_##j    = _mm_xor_si128(rk_##j, tk_1_##j);                                \
+
+#define STEP_SB23_OUT(j, r1, r23)                                               \
+    state_##j = _mm_xor_si128(state_##j, rk_##j);                               \
+
+#else
+#define STEP_SB01_IN(j, r1, r23)                                                \
+    rk_##j    = _mm_loadl_epi64((const __m128i*)(rtk_23_##j + (r23)));          \
+    tmp0_##j  = _mm_srli_epi16(state_##j, 4);                                   \
+    state_##j = _mm_and_si128(state_##j, mask_nib);                             \
+    tmp0_##j  = _mm_and_si128(tmp0_##j, mask_nib);                              \
+
+#define STEP_SB01_OUT(j, r1, r23)                                               \
+    state_##j = _mm_shuffle_epi8(s1, state_##j);                                \
+    tmp0_##j  = _mm_shuffle_epi8(s0, tmp0_##j);                                 \
+    rk_##j    = _mm_xor_si128(rk_##j, c2);                                      \
+    state_##j = _mm_xor_si128(tmp0_##j, state_##j);                             \
+
+#define STEP_SB23_IN(j, r1, r23)                                                \
+    tk_1_##j  = _mm_loadl_epi64((const __m128i*)(rtk_1_##j + (r1)));            \
+    tmp0_##j  = _mm_srli_epi16(state_##j, 4);                                   \
+    tmp1_##j  = _mm_and_si128(state_##j, mask_lsb);                             \
+    tmp0_##j  = _mm_and_si128(tmp0_##j, mask_nib);                              \
+    state_##j = _mm_and_si128(state_##j, mask_nib);                             \
+
+#define STEP_SB23_OUT(j, r1, r23)                                               \
+    tmp0_##j  = _mm_shuffle_epi8(s3, tmp0_##j);                                 \
+    state_##j = _mm_shuffle_epi8(s2, state_##j);                                \
+    tmp0_##j  = _mm_or_si128(tmp1_##j, tmp0_##j);                               \
+    rk_##j    = _mm_xor_si128(rk_##j, tk_1_##j);                                \
+    state_##j = _mm_xor_si128(state_##j, tmp0_##j);                             \
+    state_##j = _mm_xor_si128(state_##j, rk_##j);                               \
+
+#endif
+
+#define STEP_SR_MC(j, r1, r23)                                                  \
+    tmp0_##j  = _mm_shuffle_epi8(state_##j, m0);                                \
+    tmp1_##j  = _mm_and_si128(state_##j, mask_row);                             \
+    state_##j = _mm_shuffle_epi8(state_##j, m1);                                \
+    tmp0_##j  = _mm_xor_si128(tmp0_##j, tmp1_##j);                              \
+    state_##j = _mm_xor_si128(tmp0_##j, state_##j);                             \
+
+/**
+ * Apply 1 round of Skinny-128-384(+) to all the lanes.
+ */
+#define ROUND_X(LANES, r1, r23)                 \
+    LANES(STEP_SB01_IN,  r1, r23)               \
+    LANES(STEP_SB01_OUT, r1, r23)               \
+    LANES(STEP_SB23_IN,  r1, r23)               \
+    LANES(STEP_SB23_OUT, r1, r23)               \
+    LANES(STEP_SR_MC,    r1, r23)               \
+
+/**
+ * Apply 'rounds' rounds (40 for Skinny-128-384+, 56 for Skinny-128-384) to all
+ * the lanes. The TK1 round tweakeys repeat every 16 rounds.
+ */
+#define SKINNY128_384_X(LANES, rounds)                                          \
+    for(i = 0; i < (rounds)*8; i += 16) {                                       \
+        ROUND_X(LANES, (i & 127),     i);                                       \
+        ROUND_X(LANES, (i & 127) + 8, i + 8);                                   \
+    }                                                                           \
+
+#define SKINNY_X_CONSTANTS                                                      \
+    SBOX_CONSTANTS;                                                             \
+    __m128i m0 = {0x030201000c0f0e0d, 0x09080b0a06050407};                      \
+    __m128i m1 = {0x8080808009080b0a, 0x0302010009080b0a};                      \
+    __m128i c2 = {0x0000000000000000,0x0000000000000002};                       \
+    __m128i mask_row = {0x00000000ffffffff, 0x0000000000000000};                \
+
+/**
+ * Skinny-128-384+ encryption of two independent 128-bit blocks w/o any
+ * operation mode, each one with its own tweakey (e.g. two different chains of
+ * a Romulus operating mode).
+ * 
+ * Same as two calls to 'skinny128_384_plus' with both computations interleaved
+ * at the instruction level.
+ */
+void skinny128_384_plus_x2(
+    unsigned char *out_0,
+    const unsigned char *in_0,
+    const unsigned char *tk1_0,
+    const unsigned char *rtk_23_0,
+    unsigned char *out_1,
+    const unsigned char *in_1,
+    const unsigned char *tk1_1,
+    const unsigned char *rtk_23_1)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 2);
+    int i;
+    unsigned char rtk_1_0[BLOCKBYTES/2*16];
+    unsigned char rtk_1_1[BLOCKBYTES/2*16];
+    __m128i tmp0_0, tmp1_0, rk_0, tk_1_0;
+    __m128i tmp0_1, tmp1_1, rk_1, tk_1_1;
+    __m128i state_0 = _mm_loadu_si128((const __m128i*)in_0);
+    __m128i state_1 = _mm_loadu_si128((const __m128i*)in_1);
+    SKINNY_X_CONSTANTS;
+
+    precompute_rtk_1(rtk_1_0, tk1_0);
+    precompute_rtk_1(rtk_1_1, tk1_1);
+
+    SKINNY128_384_X(LANES_X2, SKINNY128_384_ROUNDS);
+
+    // put internal states into output buffers
+    _mm_storeu_si128((__m128i*)out_0, state_0);
+    _mm_storeu_si128((__m128i*)out_1, state_1);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+
+/**
+ * Encryption of three independent 128-bit blocks over 'rounds' rounds, each
+ * one with its own tweakey, with the three computations interleaved at the
+ * instruction level (also Skinny-128-256 with 'tk_schedule_2').
+ * Always inlined with a constant 'rounds' so that each variant below is
+ * compiled into its own kernel.
+ */
+static inline __attribute__((always_inline)) void skinny128_384_x3_r(
+    unsigned char *out_0,
+    const unsigned char *in_0,
+    const unsigned char *tk1_0,
+    const unsigned char *rtk_23_0,
+    unsigned char *out_1,
+    const unsigned char *in_1,
+    const unsigned char *tk1_1,
+    const unsigned char *rtk_23_1,
+    unsigned char *out_2,
+    const unsigned char *in_2,
+    const unsigned char *tk1_2,
+    const unsigned char *rtk_23_2,
+    const int rounds)
+{
+    int i;
+    unsigned char rtk_1_0[BLOCKBYTES/2*16];
+    unsigned char rtk_1_1[BLOCKBYTES/2*16];
+    unsigned char rtk_1_2[BLOCKBYTES/2*16];
+    __m128i tmp0_0, tmp1_0, rk_0, tk_1_0;
+    __m128i tmp0_1, tmp1_1, rk_1, tk_1_1;
+    __m128i tmp0_2, tmp1_2, rk_2, tk_1_2;
+    __m128i state_0 = _mm_loadu_si128((const __m128i*)in_0);
+    __m128i state_1 = _mm_loadu_si128((const __m128i*)in_1);
+    __m128i state_2 = _mm_loadu_si128((const __m128i*)in_2);
+    SKINNY_X_CONSTANTS;
+
+    precompute_rtk_1(rtk_1_0, tk1_0);
+    precompute_rtk_1(rtk_1_1, tk1_1);
+    precompute_rtk_1(rtk_1_2, tk1_2);
+
+    SKINNY128_384_X(LANES_X3, rounds);
+
+    // put internal states into output buffers
+    _mm_storeu_si128((__m128i*)out_0, state_0);
+    _mm_storeu_si128((__m128i*)out_1, state_1);
+    _mm_storeu_si128((__m128i*)out_2, state_2);
+}
+
+/**
+ * Skinny-128-384+ encryption of three independent 128-bit blocks w/o any
+ * operation mode, each one with its own tweakey.
+ * 
+ * Same as three calls to 'skinny128_384_plus' with the three computations
+ * interleaved at the instruction level.
+ */
+void skinny128_384_plus_x3(
+    unsigned char *out_0,
+    const unsigned char *in_0,
+    const unsigned char *tk1_0,
+    const unsigned char *rtk_23_0,
+    unsigned char *out_1,
+    const unsigned char *in_1,
+    const unsigned char *tk1_1,
+    const unsigned char *rtk_23_1,
+    unsigned char *out_2,
+    const unsigned char *in_2,
+    const unsigned char *tk1_2,
+    const unsigned char *rtk_23_2)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 3);
+    skinny128_384_x3_r(out_0, in_0, tk1_0, rtk_23_0, out_1, in_1, tk1_1,
+        rtk_23_1, out_2, in_2, tk1_2, rtk_23_2, SKINNY128_384_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+
+/**
+ * Skinny-128-384 (56 rounds) encryption of three independent 128-bit blocks
+ * w/o any operation mode, each one with its own tweakey (the TK2/TK3 round
+ * tweakeys being precomputed by 'tk_schedule_384').
+ * 
+ * Same as three calls to 'skinny128_384' with the three computations
+ * interleaved at the instruction level.
+ */
+void skinny128_384_x3(
+    unsigned char *out_0,
+    const unsigned char *in_0,
+    const unsigned char *tk1_0,
+    const unsigned char *rtk_23_0,
+    unsigned char *out_1,
+    const unsigned char *in_1,
+    const unsigned char *tk1_1,
+    const unsigned char *rtk_23_1,
+    unsigned char *out_2,
+    const unsigned char *in_2,
+    const unsigned char *tk1_2,
+    const unsigned char *rtk_23_2)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 3);
+    skinny128_384_x3_r(out_0, in_0, tk1_0, rtk_23_0, out_1, in_1, tk1_1,
+        rtk_23_1, out_2, in_2, tk1_2, rtk_23_2, SKINNY128_384_FULL_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+
+/**
+ * Round constants as added to the internal state, i.e. c0, c1 and c2 in bytes
+ * 0, 4 and 8, for up to the 56 rounds of Skinny-128-384.
+ */
+static const uint32_t rconst[SKINNY128_384_FULL_ROUNDS][4] __attribute__((aligned(16))) = {
+    {0x1, 0x0, 0x2, 0x0}, {0x3, 0x0, 0x2, 0x0}, {0x7, 0x0, 0x2, 0x0}, {0xf, 0x0, 0x2, 0x0},
+    {0xf, 0x1, 0x2, 0x0}, {0xe, 0x3, 0x2, 0x0}, {0xd, 0x3, 0x2, 0x0}, {0xb, 0x3, 0x2, 0x0},
+    {0x7, 0x3, 0x2, 0x0}, {0xf, 0x2, 0x2, 0x0}, {0xe, 0x1, 0x2, 0x0}, {0xc, 0x3, 0x2, 0x0},
+    {0x9, 0x3, 0x2, 0x0}, {0x3, 0x3, 0x2, 0x0}, {0x7, 0x2, 0x2, 0x0}, {0xe, 0x0, 0x2, 0x0},
+    {0xd, 0x1, 0x2, 0x0}, {0xa, 0x3, 0x2, 0x0}, {0x5, 0x3, 0x2, 0x0}, {0xb, 0x2, 0x2, 0x0},
+    {0x6, 0x1, 0x2, 0x0}, {0xc, 0x2, 0x2, 0x0}, {0x8, 0x1, 0x2, 0x0}, {0x0, 0x3, 0x2, 0x0},
+    {0x1, 0x2, 0x2, 0x0}, {0x2, 0x0, 0x2, 0x0}, {0x5, 0x0, 0x2, 0x0}, {0xb, 0x0, 0x2, 0x0},
+    {0x7, 0x1, 0x2, 0x0}, {0xe, 0x2, 0x2, 0x0}, {0xc, 0x1, 0x2, 0x0}, {0x8, 0x3, 0x2, 0x0},
+    {0x1, 0x3, 0x2, 0x0}, {0x3, 0x2, 0x2, 0x0}, {0x6, 0x0, 0x2, 0x0}, {0xd, 0x0, 0x2, 0x0},
+    {0xb, 0x1, 0x2, 0x0}, {0x6, 0x3, 0x2, 0x0}, {0xd, 0x2, 0x2, 0x0}, {0xa, 0x1, 0x2, 0x0},
+    {0x4, 0x3, 0x2, 0x0}, {0x9, 0x2, 0x2, 0x0}, {0x2, 0x1, 0x2, 0x0}, {0x4, 0x2, 0x2, 0x0},
+    {0x8, 0x0, 0x2, 0x0}, {0x1, 0x1, 0x2, 0x0}, {0x2, 0x2, 0x2, 0x0}, {0x4, 0x0, 0x2, 0x0},
+    {0x9, 0x0, 0x2, 0x0}, {0x3, 0x1, 0x2, 0x0}, {0x6, 0x2, 0x2, 0x0}, {0xc, 0x0, 0x2, 0x0},
+    {0x9, 0x1, 0x2, 0x0}, {0x2, 0x3, 0x2, 0x0}, {0x5, 0x2, 0x2, 0x0}, {0xa, 0x0, 0x2, 0x0},
+};
+
+#define RCONST(r)   _mm_load_si128((const __m128i*)rconst[r])
+
 /**
  * Double update of the tweakey states TK2 and TK3.
- * The corresponding round tweakeys 'rtk_2' and 'rtk_3' are XORed together w/
- * the round constants c0,c1 and stored in the 'rtk' output buffer.
  */ 
-#define DOUBLE_TK23_UPDATE(c00, c10, c01, c11, perm)                                \
+#define DOUBLE_TK23_UPDATE(perm)                                                    \
     rtk_3   = _mm_shuffle_epi8(rtk_3, perm);    /* permute tk3 */                   \
     rtk_2   = _mm_shuffle_epi8(rtk_2, perm);    /* permute tk2 */                   \
     tmp0    = _mm_srli_epi16(rtk_3, 6);         /* ( -, -, -, -, -, -,x7,x6) */     \
@@ -152,31 +662,30 @@ void skinny128_384_plus(
     tmp3    = _mm_andnot_si128(mask_01, tmp3);  /* discard adjacent bits */         \
     rtk_3   = _mm_xor_si128(rtk_3, tmp0);       /* (-,-,-,-,-,-,x7^x1,x6^x0) */     \
     tmp2    = _mm_xor_si128(rtk_2, tmp2);       /*(x5^x7,x4^x6, -,-,-,...,-) */     \
-    tmp0    = _mm_set_epi32(c11, c01, c10, c00);/* build rconst c0,c1 */            \
     rtk_3   = _mm_slli_epi16(rtk_3, 7);         /* (x6^x5,-,-,-,-,-,-,-) */         \
     tmp2    = _mm_srli_epi16(tmp2, 7);          /* (-,-,-,-,-,-,-,x7^x5) */         \
     rtk_3   = _mm_and_si128(rtk_3, mask_80);    /* discard adjacent bits */         \
     rtk_2   = _mm_and_si128(tmp2, mask_01);     /* discard adjacent bits */         \
     rtk_3   = _mm_or_si128(rtk_3, tmp1);        /* LFSR3(rtk3) */                   \
     rtk_2   = _mm_or_si128(rtk_2, tmp3);        /* LFSR2(rtk2) */                   \
-    tmp0    = _mm_xor_si128(tmp0, rtk_3);       /* rtk3 ^ rconst */                 \
-    tmp0    = _mm_xor_si128(tmp0, rtk_2);       /* rtk2 ^ rtk3 ^ rconst */          \
-    _mm_storeu_si128((__m128i*)rtk_23, tmp0);   /* store 2 rtk at once */           \
-    rtk_23  += 16;                              /* now points to the next rtk */    \
 
 /**
- * Precompute the round tweakeys for TK2 and TK3 tweakey states, including the
- * round constants c0,c1.
+ * Precompute the round tweakeys for TK2 and TK3 tweakey states over 'rounds'
+ * rounds, including the round constants c0,c1.
+ * The round tweakeys of two consecutive rounds are XORed together w/ their
+ * round constants and stored at once.
  */
-void tk_schedule_23(
+static inline void tk_schedule_23_x(
     unsigned char *rtk_23,
     const unsigned char *tk2,
-    const unsigned char *tk3)
+    const unsigned char *tk3,
+    const int rounds)
 {
+    int i;
     __m128i tmp0;
     __m128i tmp1;
     __m128i tmp2;
-    __m128i tmp3    = {0x0000000000000001, 0x0000000000000000};
+    __m128i tmp3;
     __m128i rtk_2   = _mm_loadu_si128((const __m128i*)tk2);
     __m128i rtk_3   = _mm_loadu_si128((const __m128i*)tk3);
     __m128i perm_0  = {0x0b0c0e0a0d080f09, 0x0304060205000701};
@@ -184,53 +693,609 @@ void tk_schedule_23(
     __m128i mask_01 = {0x0101010101010101, 0x0101010101010101}; // not(mask_fe)
     __m128i mask_03 = {0x0303030303030303, 0x0303030303030303}; // not(mask_fc)
     __m128i mask_80 = {0x8080808080808080, 0x8080808080808080}; // not(mask_7f)
+    __m128i perm    = perm_0;
 
     // first round tweakeys is simply extracted from the initial tweakey states
-    tmp0    = _mm_xor_si128(tmp3, rtk_3);
+    tmp0    = _mm_xor_si128(RCONST(0), rtk_3);
     tmp0    = _mm_xor_si128(tmp0, rtk_2);
     _mm_storeu_si64((__m128i*)rtk_23, tmp0);
-    rtk_23  += 8;
     // next round tweakeys are computed using double updates to save cycles
-    DOUBLE_TK23_UPDATE(0x03, 0x00, 0x07, 0x00, perm_0);
-    DOUBLE_TK23_UPDATE(0x0f, 0x00, 0x0f, 0x01, perm_tk);
-    DOUBLE_TK23_UPDATE(0x0e, 0x03, 0x0d, 0x03, perm_tk);
-    DOUBLE_TK23_UPDATE(0x0b, 0x03, 0x07, 0x03, perm_tk);
-    DOUBLE_TK23_UPDATE(0x0f, 0x02, 0x0e, 0x01, perm_tk);
-    DOUBLE_TK23_UPDATE(0x0c, 0x03, 0x09, 0x03, perm_tk);
-    DOUBLE_TK23_UPDATE(0x03, 0x03, 0x07, 0x02, perm_tk);
-    DOUBLE_TK23_UPDATE(0x0e, 0x00, 0x0d, 0x01, perm_tk);
-    DOUBLE_TK23_UPDATE(0x0a, 0x03, 0x05, 0x03, perm_tk);
-    DOUBLE_TK23_UPDATE(0x0b, 0x02, 0x06, 0x01, perm_tk);
-    DOUBLE_TK23_UPDATE(0x0c, 0x02, 0x08, 0x01, perm_tk);
-    DOUBLE_TK23_UPDATE(0x00, 0x03, 0x01, 0x02, perm_tk);
-    DOUBLE_TK23_UPDATE(0x02, 0x00, 0x05, 0x00, perm_tk);
-    DOUBLE_TK23_UPDATE(0x0b, 0x00, 0x07, 0x01, perm_tk);
-    DOUBLE_TK23_UPDATE(0x0e, 0x02, 0x0c, 0x01, perm_tk);
-    DOUBLE_TK23_UPDATE(0x08, 0x03, 0x01, 0x03, perm_tk);
-    DOUBLE_TK23_UPDATE(0x03, 0x02, 0x06, 0x00, perm_tk);
-    DOUBLE_TK23_UPDATE(0x0d, 0x00, 0x0b, 0x01, perm_tk);
-    DOUBLE_TK23_UPDATE(0x06, 0x03, 0x0d, 0x02, perm_tk);
-    // do not use the macro since we only need to store 64-bit for the last rtk
-    rtk_3   = _mm_shuffle_epi8(rtk_3, perm_tk);
-    rtk_2   = _mm_shuffle_epi8(rtk_2, perm_tk);
-    tmp0    = _mm_srli_epi16(rtk_3, 6);
-    tmp1    = _mm_srli_epi16(rtk_3, 1);
-    tmp2    = _mm_slli_epi16(rtk_2, 2);
-    tmp3    = _mm_slli_epi16(rtk_2, 1);
-    tmp0    = _mm_and_si128(tmp0, mask_03);
-    tmp1    = _mm_andnot_si128(mask_80, tmp1);
-    tmp2    = _mm_andnot_si128(mask_03, tmp2);
-    tmp3    = _mm_andnot_si128(mask_01, tmp3);
-    rtk_3   = _mm_xor_si128(rtk_3, tmp0);
-    tmp2    = _mm_xor_si128(rtk_2, tmp2);
-    tmp0    = _mm_set_epi32(0x0, 0x0, 0x1, 0xa);
-    rtk_3   = _mm_slli_epi16(rtk_3, 7);
-    tmp2    = _mm_srli_epi16(tmp2, 7);
-    rtk_3   = _mm_and_si128(rtk_3, mask_80);
-    tmp2    = _mm_and_si128(tmp2, mask_01);
-    rtk_3   = _mm_or_si128(rtk_3, tmp1);
-    rtk_2   = _mm_or_si128(tmp2, tmp3);
-    tmp0    = _mm_xor_si128(tmp0, rtk_3);
+    for(i = 1; i < rounds - 1; i += 2) {
+        DOUBLE_TK23_UPDATE(perm);
+        tmp0    = _mm_unpacklo_epi64(RCONST(i), RCONST(i+1));
+        tmp0    = _mm_xor_si128(tmp0, rtk_3);
+        tmp0    = _mm_xor_si128(tmp0, rtk_2);
+        _mm_storeu_si128((__m128i*)(rtk_23 + 8*i), tmp0);
+        perm    = perm_tk;
+    }
+    // only 64 bits to store for the last rtk
+    DOUBLE_TK23_UPDATE(perm_tk);
+    tmp0    = _mm_xor_si128(RCONST(rounds - 1), rtk_3);
     tmp0    = _mm_xor_si128(tmp0, rtk_2);
-    _mm_storeu_si64((__m128i*)rtk_23, tmp0);
+    _mm_storeu_si64((__m128i*)(rtk_23 + 8*(rounds - 1)), tmp0);
+}
+
+/**
+ * Precompute the round tweakeys for TK2 and TK3 tweakey states, including the
+ * round constants c0,c1, for the 40 rounds of Skinny-128-384+ ...
+ */
+void tk_schedule_23(
+    unsigned char *rtk_23,
+    const unsigned char *tk2,
+    const unsigned char *tk3)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_23, 1);
+    tk_schedule_23_x(rtk_23, tk2, tk3, SKINNY128_384_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_23);
+}
+
+/**
+ * ... or for the 56 rounds of Skinny-128-384.
+ */
+void tk_schedule_384(
+    unsigned char *rtk_23,
+    const unsigned char *tk2,
+    const unsigned char *tk3)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_23, 1);
+    tk_schedule_23_x(rtk_23, tk2, tk3, SKINNY128_384_FULL_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_23);
+}
+
+/******************************************************************************
+ * Skinny-128-128 and Skinny-128-256 kernels.
+ * 
+ * They rely on the same S-box and linear layer as Skinny-128-384+, only the
+ * tweakey schedule differs. Two options are provided for each variant:
+ *  - precomputed: the round tweakeys depending on the key are computed once,
+ *    by 'tk_schedule_1' for the whole Skinny-128-128 tweakey or by
+ *    'tk_schedule_2' for the TK2 of Skinny-128-256, whose TK1 is processed as
+ *    in 'skinny128_384_plus' since it usually carries the tweak;
+ *  - on-the-fly ('_otf'): the round tweakeys are computed along with the
+ *    encryption, two rounds at a time, when a tweakey is only used once.
+ *****************************************************************************/
+
+#define TK_CONSTANTS                                                            \
+    __m128i perm_0  = {0x0b0c0e0a0d080f09, 0x0304060205000701};                 \
+    __m128i perm_tk = {0x0304060205000701, 0x0b0c0e0a0d080f09};                 \
+    __m128i mask_01 = {0x0101010101010101, 0x0101010101010101};                 \
+    __m128i mask_03 = {0x0303030303030303, 0x0303030303030303};                 \
+
+/**
+ * Apply LFSR2 to all the bytes of 'x' (see 'DOUBLE_TK23_UPDATE').
+ */
+#define LFSR2(x)                                                                \
+    tmp2    = _mm_slli_epi16(x, 2);             /* (x5,x4,x3,x2,x1,x0, -, -) */ \
+    tmp3    = _mm_slli_epi16(x, 1);             /* (x6,x5,x4,x3,x2,x1,x0, -) */ \
+    tmp2    = _mm_andnot_si128(mask_03, tmp2);  /* discard adjacent bits */     \
+    tmp3    = _mm_andnot_si128(mask_01, tmp3);  /* discard adjacent bits */     \
+    tmp2    = _mm_xor_si128(x, tmp2);           /* (x7^x5, -,-,-,-,-,-,-) */    \
+    tmp2    = _mm_srli_epi16(tmp2, 7);          /* (-,-,-,-,-,-,-,x7^x5) */     \
+    tmp2    = _mm_and_si128(tmp2, mask_01);     /* discard adjacent bits */     \
+    x       = _mm_or_si128(tmp2, tmp3);         /* LFSR2(x) */                  \
+
+/**
+ * Computes the round tweakeys of the single tweakey state 'tk', updated with
+ * LFSR2 if 'lfsr2' is set, and adds the round constants c0,c1.
+ * As in 'tk_schedule_23', the round tweakeys are computed two at a time and
+ * only the half which is added to the internal state is stored.
+ */
+static inline void tk_schedule_x(
+    unsigned char *rtk,
+    const unsigned char *tk,
+    int lfsr2,
+    int rounds)
+{
+    int i;
+    __m128i tmp0, tmp2, tmp3;
+    __m128i rtk_x   = _mm_loadu_si128((const __m128i*)tk);
+    __m128i perm;
+    TK_CONSTANTS;
+
+    // first round tweakeys is simply extracted from the initial tweakey state
+    tmp0    = _mm_xor_si128(rtk_x, RCONST(0));
+    _mm_storeu_si64((__m128i*)rtk, tmp0);
+    perm    = perm_0;
+    for(i = 1; i < rounds - 1; i += 2) {
+        rtk_x   = _mm_shuffle_epi8(rtk_x, perm);
+        if (lfsr2) {
+            LFSR2(rtk_x);
+        }
+        tmp0    = _mm_unpacklo_epi64(RCONST(i), RCONST(i+1));
+        tmp0    = _mm_xor_si128(tmp0, rtk_x);
+        _mm_storeu_si128((__m128i*)(rtk + 8*i), tmp0);
+        perm    = perm_tk;
+    }
+    // only 64 bits to store for the last rtk
+    rtk_x   = _mm_shuffle_epi8(rtk_x, perm_tk);
+    if (lfsr2) {
+        LFSR2(rtk_x);
+    }
+    tmp0    = _mm_xor_si128(rtk_x, RCONST(rounds - 1));
+    _mm_storeu_si64((__m128i*)(rtk + 8*(rounds - 1)), tmp0);
+}
+
+/**
+ * Precomputation of the Skinny-128-128 round tweakeys, including the round
+ * constants c0,c1.
+ */
+void tk_schedule_1(
+    unsigned char *rtk,
+    const unsigned char *tk1)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_1, 1);
+    tk_schedule_x(rtk, tk1, 0, SKINNY128_128_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_1);
+}
+
+/**
+ * Precomputation of the round tweakeys for the TK2 tweakey state of
+ * Skinny-128-256, including the round constants c0,c1.
+ */
+void tk_schedule_2(
+    unsigned char *rtk_2,
+    const unsigned char *tk2)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_TK_SCHEDULE_23, 1);
+    tk_schedule_x(rtk_2, tk2, 1, SKINNY128_256_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_TK_SCHEDULE_23);
+}
+
+/**
+ * Apply the S-box, Add Round Tweakey, and Add Round Constants to the internal
+ * state 'state', for a precomputed round tweakey 'rtk_k' which already includes
+ * the round constants c0,c1.
+ */
+#define SBOX_ARK_1(rtk_k)                                                       \
+    rtk   = LOAD_RTK_23(rtk_k);             /* load roundtweakey */             \
+    rtk   = VXOR(rtk, c2);                  /* add rconst c2 */                 \
+    SBOX();                                 /* apply S-box */                   \
+    state = VXOR(state, rtk);               /* add rtweakey and rconsts */      \
+
+/**
+ * Apply the S-box, Add Round Tweakey, and Add Round Constants to the internal
+ * state 'state', for a round tweakey 'rtk_r' computed on-the-fly (whose upper
+ * half is null) at round 'r'.
+ */
+#define SBOX_ARK_OTF(rtk_r, r)                                                  \
+    rtk   = _mm_xor_si128(rtk_r, RCONST(r));/* add rconsts c0,c1,c2 */          \
+    SBOX();                                 /* apply S-box */                   \
+    state = VXOR(state, rtk);               /* add rtweakey and rconsts */      \
+
+/**
+ * Next round tweakeys (for two rounds) of the on-the-fly kernels, in 'rtk_x'.
+ */
+#define TK_UPDATE_1(perm)                                                       \
+    tk_1    = _mm_shuffle_epi8(tk_1, perm);                                     \
+    rtk_x   = tk_1;                                                             \
+
+#define TK_UPDATE_12(perm)                                                      \
+    tk_1    = _mm_shuffle_epi8(tk_1, perm);                                     \
+    tk_2    = _mm_shuffle_epi8(tk_2, perm);                                     \
+    LFSR2(tk_2);                                                                \
+    rtk_x   = _mm_xor_si128(tk_1, tk_2);                                        \
+
+/**
+ * All the rounds of an on-the-fly kernel, the round tweakeys being updated by
+ * 'TK_UPDATE' from the first round tweakey in 'rtk_x'.
+ */
+#define SKINNY128_OTF(TK_UPDATE, ROUNDS)                                        \
+    SBOX_ARK_OTF(_mm_move_epi64(rtk_x), 0);                                     \
+    SR_MC();                                                                    \
+    perm = perm_0;                                                              \
+    for(i = 1; i < (ROUNDS) - 1; i += 2) {                                      \
+        TK_UPDATE(perm);                                                        \
+        SBOX_ARK_OTF(_mm_move_epi64(rtk_x), i);                                 \
+        SR_MC();                                                                \
+        SBOX_ARK_OTF(_mm_srli_si128(rtk_x, 8), i + 1);                          \
+        SR_MC();                                                                \
+        perm = perm_tk;                                                         \
+    }                                                                           \
+    TK_UPDATE(perm_tk);                                                         \
+    SBOX_ARK_OTF(_mm_move_epi64(rtk_x), (ROUNDS) - 1);                          \
+    SR_MC();                                                                    \
+
+#define SKINNY_CONSTANTS                                                        \
+    SBOX_CONSTANTS;                                                             \
+    __m128i m0 = {0x030201000c0f0e0d, 0x09080b0a06050407};                      \
+    __m128i m1 = {0x8080808009080b0a, 0x0302010009080b0a};                      \
+    __m128i c2 = {0x0000000000000000,0x0000000000000002};                       \
+    __m128i mask_row = {0x00000000ffffffff, 0x0000000000000000};                \
+
+/**
+ * Skinny-128-128 encryption of a single 128-bit block w/o any operation mode,
+ * with the round tweakeys precomputed by 'tk_schedule_1'.
+ */
+void skinny128_128(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *rtk_k)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 1);
+    int i;
+    __m128i tmp0, tmp1, rtk;
+    __m128i state = _mm_loadu_si128((const __m128i*)in);
+    SKINNY_CONSTANTS;
+
+    for(i = 0; i < SKINNY128_128_ROUNDS*8; i += 8) {
+        SBOX_ARK_1(rtk_k + i);
+        SR_MC();
+    }
+
+    _mm_storeu_si128((__m128i*)out, state);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+
+/**
+ * Skinny-128-256 encryption of a single 128-bit block w/o any operation mode.
+ * 
+ * The round tweakeys are assumed to be precomputed for TK2 by 'tk_schedule_2'
+ * while they are computed on-the-fly for TK1.
+ */
+void skinny128_256(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1,
+    const unsigned char *rtk_2)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 1);
+    int i;
+    unsigned char rtk_1[BLOCKBYTES/2*16];
+    __m128i tmp0, tmp1, rtk, tk_1;
+    __m128i state = _mm_loadu_si128((const __m128i*)in);
+    SKINNY_CONSTANTS;
+
+    precompute_rtk_1(rtk_1, tk1);
+
+    // the TK1 round tweakeys repeat every 16 rounds
+    for(i = 0; i < SKINNY128_256_ROUNDS*8; i += 16) {
+        DOUBLE_ROUND(rtk_1 + (i & 127), rtk_2 + i);
+    }
+
+    _mm_storeu_si128((__m128i*)out, state);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+
+/**
+ * Skinny-128-256 decryption of a single 128-bit block w/o any operation mode,
+ * with the round tweakeys for TK2 precomputed by 'tk_schedule_2'.
+ */
+void skinny128_256_inv(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1,
+    const unsigned char *rtk_2)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY_INV, 1);
+    skinny128_384_inv_x(out, in, tk1, rtk_2, SKINNY128_256_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY_INV);
+}
+
+/**
+ * Skinny-128-256 encryption of three independent 128-bit blocks w/o any
+ * operation mode, each one with its own TK1 and the TK2 round tweakeys
+ * precomputed by 'tk_schedule_2'.
+ * 
+ * Same as three calls to 'skinny128_256' with the three computations
+ * interleaved at the instruction level.
+ */
+void skinny128_256_x3(
+    unsigned char *out_0,
+    const unsigned char *in_0,
+    const unsigned char *tk1_0,
+    const unsigned char *rtk_2_0,
+    unsigned char *out_1,
+    const unsigned char *in_1,
+    const unsigned char *tk1_1,
+    const unsigned char *rtk_2_1,
+    unsigned char *out_2,
+    const unsigned char *in_2,
+    const unsigned char *tk1_2,
+    const unsigned char *rtk_2_2)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 3);
+    skinny128_384_x3_r(out_0, in_0, tk1_0, rtk_2_0, out_1, in_1, tk1_1,
+        rtk_2_1, out_2, in_2, tk1_2, rtk_2_2, SKINNY128_256_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+
+/**
+ * Skinny-128-128 encryption of a single 128-bit block w/o any operation mode,
+ * with the tweakey schedule computed on-the-fly.
+ */
+void skinny128_128_otf(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 1);
+    int i;
+    __m128i tmp0, tmp1, rtk, perm;
+    __m128i tk_1  = _mm_loadu_si128((const __m128i*)tk1);
+    __m128i rtk_x = tk_1;
+    __m128i state = _mm_loadu_si128((const __m128i*)in);
+    SKINNY_CONSTANTS;
+    TK_CONSTANTS;
+    (void)c2; (void)mask_01; (void)mask_03;
+
+    SKINNY128_OTF(TK_UPDATE_1, SKINNY128_128_ROUNDS);
+
+    _mm_storeu_si128((__m128i*)out, state);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+
+/**
+ * Skinny-128-256 encryption of a single 128-bit block w/o any operation mode,
+ * with the tweakey schedule computed on-the-fly.
+ */
+void skinny128_256_otf(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1,
+    const unsigned char *tk2)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 1);
+    int i;
+    __m128i tmp0, tmp1, tmp2, tmp3, rtk, perm;
+    __m128i tk_1  = _mm_loadu_si128((const __m128i*)tk1);
+    __m128i tk_2  = _mm_loadu_si128((const __m128i*)tk2);
+    __m128i rtk_x = _mm_xor_si128(tk_1, tk_2);
+    __m128i state = _mm_loadu_si128((const __m128i*)in);
+    SKINNY_CONSTANTS;
+    TK_CONSTANTS;
+    (void)c2;
+
+    SKINNY128_OTF(TK_UPDATE_12, SKINNY128_256_ROUNDS);
+
+    _mm_storeu_si128((__m128i*)out, state);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+
+#if defined(__AVX2__)
+/******************************************************************************
+ * AVX2 kernels: two consecutive blocks are processed at once, one in each
+ * 128-bit lane of YMM registers, through the same S-box and linear layer
+ * macros since 'vpshufb' operates within lanes. Both blocks share the key
+ * part of the tweakey, whose precomputed round tweakeys are broadcast to both
+ * lanes, while Skinny-128-256/384 take a distinct TK1 (e.g. tweak) per block.
+ * The 'vpermi2b' S-box (SKINNY_SBOX_VBMI) only handles 128-bit states so the
+ * 4-bit lookups are always used here.
+ *****************************************************************************/
+#undef VXOR
+#undef VAND
+#undef VOR
+#undef VSHUF
+#undef VSRLI16
+#undef LOAD_RTK_1
+#undef LOAD_RTK_23
+#undef SBOX
+#define VXOR(a, b)      _mm256_xor_si256(a, b)
+#define VAND(a, b)      _mm256_and_si256(a, b)
+#define VOR(a, b)       _mm256_or_si256(a, b)
+#define VSHUF(a, b)     _mm256_shuffle_epi8(a, b)
+#define VSRLI16(a, n)   _mm256_srli_epi16(a, n)
+// TK1 round tweakeys of both blocks, interleaved by 'precompute_rtk_1_x2'
+#define LOAD_RTK_1(p)   _mm256_loadu_si256((const __m256i*)(p))
+// 64-bit round tweakey broadcast to the lower half of both lanes
+#define LOAD_RTK_23(p)                                                          \
+    _mm256_blend_epi32(_mm256_broadcastq_epi64(                                 \
+        _mm_loadl_epi64((const __m128i*)(p))), _mm256_setzero_si256(), 0xcc)
+#define SBOX()          SBOX_NIBBLES()
+
+#define SKINNY_CONSTANTS_X2                                                     \
+    __m256i s0 = {0xb090a08010300020, 0xb898a88838182808,                       \
+                  0xb090a08010300020, 0xb898a88838182808};                      \
+    __m256i s1 = {0x45044405004181c0, 0x470746064303c282,                       \
+                  0x45044405004181c0, 0x470746064303c282};                      \
+    __m256i s2 = {0x1810080019110901, 0x1a130a031b120b02,                       \
+                  0x1810080019110901, 0x1a130a031b120b02};                      \
+    __m256i s3 = {0xe063a033c0431380, 0xe464a434c4441484,                       \
+                  0xe063a033c0431380, 0xe464a434c4441484};                      \
+    __m256i mask_nib = _mm256_set1_epi8(0x0f);                                  \
+    __m256i mask_lsb = _mm256_set1_epi8(0x01);                                  \
+    __m256i m0 = {0x030201000c0f0e0d, 0x09080b0a06050407,                       \
+                  0x030201000c0f0e0d, 0x09080b0a06050407};                      \
+    __m256i m1 = {0x8080808009080b0a, 0x0302010009080b0a,                       \
+                  0x8080808009080b0a, 0x0302010009080b0a};                      \
+    __m256i c2 = {0x0000000000000000, 0x0000000000000002,                       \
+                  0x0000000000000000, 0x0000000000000002};                      \
+    __m256i mask_row = {0x00000000ffffffff, 0x0000000000000000,                 \
+                        0x00000000ffffffff, 0x0000000000000000};                \
+
+/**
+ * Interleave the TK1 round tweakeys of two blocks (16 rounds), so that those of
+ * a given round are loaded at once with a zeroed upper half in each lane.
+ */
+static inline void precompute_rtk_1_x2(
+    unsigned char *rtk_1,
+    const unsigned char *tk1_0,
+    const unsigned char *tk1_1)
+{
+    int i;
+    unsigned char rtk_1_0[BLOCKBYTES/2*16];
+    unsigned char rtk_1_1[BLOCKBYTES/2*16];
+
+    precompute_rtk_1(rtk_1_0, tk1_0);
+    precompute_rtk_1(rtk_1_1, tk1_1);
+    for(i = 0; i < 16; i++)
+        _mm256_storeu_si256((__m256i*)(rtk_1 + 32*i), _mm256_set_m128i(
+            _mm_loadl_epi64((const __m128i*)(rtk_1_1 + 8*i)),
+            _mm_loadl_epi64((const __m128i*)(rtk_1_0 + 8*i))));
+}
+
+/**
+ * Skinny-128-128 encryption of two consecutive 128-bit blocks w/o any
+ * operation mode, under the same round tweakeys precomputed by
+ * 'tk_schedule_1'.
+ */
+void skinny128_128_x2(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *rtk_k)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 2);
+    int i;
+    __m256i tmp0, tmp1, rtk;
+    __m256i state = _mm256_loadu_si256((const __m256i*)in);
+    SKINNY_CONSTANTS_X2;
+
+    for(i = 0; i < SKINNY128_128_ROUNDS*8; i += 8) {
+        SBOX_ARK_1(rtk_k + i);
+        SR_MC();
+    }
+
+    _mm256_storeu_si256((__m256i*)out, state);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+
+/**
+ * Encryption of two consecutive 128-bit blocks over 'rounds' rounds, with a
+ * distinct TK1 for each block ('tk1_0' and 'tk1_1') and the same round
+ * tweakeys for the key part ('rtk_2' or 'rtk_23', 8 bytes per round).
+ * Always inlined with a constant 'rounds' so that each variant below is
+ * compiled into its own kernel.
+ */
+static inline __attribute__((always_inline)) void skinny128_tk1_x2(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1_0,
+    const unsigned char *tk1_1,
+    const unsigned char *rtk_k,
+    const int rounds)
+{
+    int i;
+    unsigned char rtk_1[2*BLOCKBYTES*16];
+    __m256i tmp0, tmp1, rtk, tk_1;
+    __m256i state = _mm256_loadu_si256((const __m256i*)in);
+    SKINNY_CONSTANTS_X2;
+
+    precompute_rtk_1_x2(rtk_1, tk1_0, tk1_1);
+
+    // the TK1 round tweakeys repeat every 16 rounds
+    for(i = 0; i < rounds; i++) {
+        SBOX_ARK(rtk_1 + 32*(i & 15), rtk_k + 8*i);
+        SR_MC();
+    }
+
+    _mm256_storeu_si256((__m256i*)out, state);
+}
+
+/**
+ * Skinny-128-256 encryption of two consecutive 128-bit blocks w/o any
+ * operation mode, with a distinct TK1 for each block ('tk1_0' and 'tk1_1') and
+ * the same TK2 round tweakeys precomputed by 'tk_schedule_2'.
+ */
+void skinny128_256_x2(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1_0,
+    const unsigned char *tk1_1,
+    const unsigned char *rtk_2)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 2);
+    skinny128_tk1_x2(out, in, tk1_0, tk1_1, rtk_2, SKINNY128_256_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+
+/**
+ * Skinny-128-384 (56 rounds) encryption of two consecutive 128-bit blocks w/o
+ * any operation mode, with a distinct TK1 for each block ('tk1_0' and 'tk1_1')
+ * and the same TK2/TK3 round tweakeys precomputed by 'tk_schedule_384'.
+ */
+void skinny128_384_x2(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1_0,
+    const unsigned char *tk1_1,
+    const unsigned char *rtk_23)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY, 2);
+    skinny128_tk1_x2(out, in, tk1_0, tk1_1, rtk_23, SKINNY128_384_FULL_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY);
+}
+#define INV_SKINNY_CONSTANTS_X2                                                 \
+    __m256i is0 = {0x0a0e02060c080400, 0x1a1e1216181c1014,                      \
+                   0x0a0e02060c080400, 0x1a1e1216181c1014};                     \
+    __m256i is1 = {0x6525246445050444, 0xe5a5e4a4c585c484,                      \
+                   0x6525246445050444, 0xe5a5e4a4c585c484};                     \
+    __m256i is2 = {0x062646e6426202a2, 0x042444e4002040e0,                      \
+                   0x062646e6426202a2, 0x042444e4002040e0};                     \
+    __m256i is3 = {0xfa7aca4ab0308000, 0xfb7beb6bf373e363,                      \
+                   0xfa7aca4ab0308000, 0xfb7beb6bf373e363};                     \
+    __m256i is4 = {0x6070405030201000, 0xe0f0c0d0a0b08090,                      \
+                   0x6070405030201000, 0xe0f0c0d0a0b08090};                     \
+    __m256i is5 = {0x1716151412131011, 0x1f1e1d1c1b1a1918,                      \
+                   0x1716151412131011, 0x1f1e1d1c1b1a1918};                     \
+    __m256i mask_nib = _mm256_set1_epi8(0x0f);                                  \
+    __m256i mask_b6  = _mm256_set1_epi8(0x40);                                  \
+    __m256i im0 = {0x0407060507060504, 0x0201000305040706,                      \
+                   0x0407060507060504, 0x0201000305040706};                     \
+    __m256i im1 = {0x080b0a0980808080, 0x0e0d0c0f0d0c0f0e,                      \
+                   0x080b0a0980808080, 0x0e0d0c0f0d0c0f0e};                     \
+    __m256i im2 = {0x0c0f0e0d80808080, 0x8080808080808080,                      \
+                   0x0c0f0e0d80808080, 0x8080808080808080};                     \
+    __m256i c2 = {0x0000000000000000, 0x0000000000000002,                       \
+                  0x0000000000000000, 0x0000000000000002};                      \
+
+/**
+ * Decryption of two consecutive 128-bit blocks over 'rounds' rounds, with the
+ * same round tweakeys as 'skinny128_tk1_x2'.
+ * Always inlined with a constant 'rounds' so that each variant below is
+ * compiled into its own kernel.
+ */
+static inline __attribute__((always_inline)) void skinny128_tk1_inv_x2(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1_0,
+    const unsigned char *tk1_1,
+    const unsigned char *rtk_k,
+    const int rounds)
+{
+    int i;
+    unsigned char rtk_1[2*BLOCKBYTES*16];
+    __m256i tmp0, tmp1, rtk, tk_1;
+    __m256i state = _mm256_loadu_si256((const __m256i*)in);
+    INV_SKINNY_CONSTANTS_X2;
+
+    precompute_rtk_1_x2(rtk_1, tk1_0, tk1_1);
+
+    for(i = rounds - 1; i >= 0; i--) {
+        INV_ROUND(rtk_1 + 32*(i & 15), rtk_k + 8*i);
+    }
+
+    _mm256_storeu_si256((__m256i*)out, state);
+}
+
+/**
+ * Skinny-128-256 decryption of two consecutive 128-bit blocks w/o any
+ * operation mode, with the same round tweakeys as 'skinny128_256_x2'.
+ */
+void skinny128_256_inv_x2(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1_0,
+    const unsigned char *tk1_1,
+    const unsigned char *rtk_2)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY_INV, 2);
+    skinny128_tk1_inv_x2(out, in, tk1_0, tk1_1, rtk_2, SKINNY128_256_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY_INV);
+}
+
+/**
+ * Skinny-128-384 (56 rounds) decryption of two consecutive 128-bit blocks w/o
+ * any operation mode, with the same round tweakeys as 'skinny128_384_x2'.
+ */
+void skinny128_384_inv_x2(
+    unsigned char *out,
+    const unsigned char *in,
+    const unsigned char *tk1_0,
+    const unsigned char *tk1_1,
+    const unsigned char *rtk_23)
+{
+    SKINNY_STATS_BEGIN(SKINNY_STATS_SKINNY_INV, 2);
+    skinny128_tk1_inv_x2(out, in, tk1_0, tk1_1, rtk_23,
+        SKINNY128_384_FULL_ROUNDS);
+    SKINNY_STATS_END(SKINNY_STATS_SKINNY_INV);
 }
+#endif
@@ -2,7 +2,10 @@
 
 #define BLOCKBYTES 				16
 #define TWEAKEYBYTES 			16
-#define SKINNY128_384_ROUNDS	40
+#define SKINNY128_384_ROUNDS	40	// Skinny-128-384+
+#define SKINNY128_384_FULL_ROUNDS	56
+#define SKINNY128_128_ROUNDS	40
+#define SKINNY128_256_ROUNDS	48
 
 /**
  * Skinny-128-384+ simple (i.e. without operating mode) encryption function.
@@ -14,6 +17,69 @@ void skinny128_384_plus(
 	const uint8_t tk1[TWEAKEYBYTES],
 	const uint8_t rtk_23[SKINNY128_384_ROUNDS*BLOCKBYTES/2]);
 
+/**
+ * Skinny-128-384 (56 rounds) encryption function, with the round tweakeys for
+ * TK2 and TK3 precomputed by 'tk_schedule_384'.
+ */
+void skinny128_384(
+	uint8_t out[BLOCKBYTES], const uint8_t in[BLOCKBYTES],
+	const uint8_t tk1[TWEAKEYBYTES],
+	const uint8_t rtk_23[SKINNY128_384_FULL_ROUNDS*BLOCKBYTES/2]);
+
+/**
+ * Skinny-128-384+ (resp. Skinny-128-384) decryption functions, taking the same
+ * round tweakeys as the encryption ones.
+ */
+void skinny128_384_plus_inv(
+	uint8_t out[BLOCKBYTES], const uint8_t in[BLOCKBYTES],
+	const uint8_t tk1[TWEAKEYBYTES],
+	const uint8_t rtk_23[SKINNY128_384_ROUNDS*BLOCKBYTES/2]);
+
+void skinny128_384_inv(
+	uint8_t out[BLOCKBYTES], const uint8_t in[BLOCKBYTES],
+	const uint8_t tk1[TWEAKEYBYTES],
+	const uint8_t rtk_23[SKINNY128_384_FULL_ROUNDS*BLOCKBYTES/2]);
+
+/**
+ * Two (resp. three) independent Skinny-128-384+ encryptions, each one with its
+ * own TK1 and TK2/TK3 round tweakeys, computed round by round with their
+ * instructions interleaved (e.g. to run several chains of a Romulus operating
+ * mode in parallel within a single core).
+ */
+void skinny128_384_plus_x2(
+	uint8_t out_0[BLOCKBYTES], const uint8_t in_0[BLOCKBYTES],
+	const uint8_t tk1_0[TWEAKEYBYTES],
+	const uint8_t rtk_23_0[SKINNY128_384_ROUNDS*BLOCKBYTES/2],
+	uint8_t out_1[BLOCKBYTES], const uint8_t in_1[BLOCKBYTES],
+	const uint8_t tk1_1[TWEAKEYBYTES],
+	const uint8_t rtk_23_1[SKINNY128_384_ROUNDS*BLOCKBYTES/2]);
+
+void skinny128_384_plus_x3(
+	uint8_t out_0[BLOCKBYTES], const uint8_t in_0[BLOCKBYTES],
+	const uint8_t tk1_0[TWEAKEYBYTES],
+	const uint8_t rtk_23_0[SKINNY128_384_ROUNDS*BLOCKBYTES/2],
+	uint8_t out_1[BLOCKBYTES], const uint8_t in_1[BLOCKBYTES],
+	const uint8_t tk1_1[TWEAKEYBYTES],
+	const uint8_t rtk_23_1[SKINNY128_384_ROUNDS*BLOCKBYTES/2],
+	uint8_t out_2[BLOCKBYTES], const uint8_t in_2[BLOCKBYTES],
+	const uint8_t tk1_2[TWEAKEYBYTES],
+	const uint8_t rtk_23_2[SKINNY128_384_ROUNDS*BLOCKBYTES/2]);
+
+/**
+ * Same as 'skinny128_384_plus_x3' for the 56 rounds of Skinny-128-384, with the
+ * round tweakeys for TK2 and TK3 precomputed by 'tk_schedule_384'.
+ */
+void skinny128_384_x3(
+	uint8_t out_0[BLOCKBYTES], const uint8_t in_0[BLOCKBYTES],
+	const uint8_t tk1_0[TWEAKEYBYTES],
+	const uint8_t rtk_23_0[SKINNY128_384_FULL_ROUNDS*BLOCKBYTES/2],
+	uint8_t out_1[BLOCKBYTES], const uint8_t in_1[BLOCKBYTES],
+	const uint8_t tk1_1[TWEAKEYBYTES],
+	const uint8_t rtk_23_1[SKINNY128_384_FULL_ROUNDS*BLOCKBYTES/2],
+	uint8_t out_2[BLOCKBYTES], const uint8_t in_2[BLOCKBYTES],
+	const uint8_t tk1_2[TWEAKEYBYTES],
+	const uint8_t rtk_23_2[SKINNY128_384_FULL_ROUNDS*BLOCKBYTES/2]);
+
 /**
  * Precomputation of round tweakeys for TK2 and TK3 (also include a part of the
  * round constants).
@@ -23,3 +89,114 @@ void tk_schedule_23(
 	const uint8_t tk2[TWEAKEYBYTES],
 	const uint8_t tk3[TWEAKEYBYTES]);
 
+/**
+ * Same as 'tk_schedule_23' for the 56 rounds of Skinny-128-384.
+ */
+void tk_schedule_384(
+	uint8_t rtk_23[SKINNY128_384_FULL_ROUNDS*BLOCKBYTES/2],
+	const uint8_t tk2[TWEAKEYBYTES],
+	const uint8_t tk3[TWEAKEYBYTES]);
+
+/**
+ * Precomputation of the Skinny-128-128 round tweakeys (also include a part of
+ * the round constants).
+ */
+void tk_schedule_1(
+	uint8_t rtk[SKINNY128_128_ROUNDS*BLOCKBYTES/2],
+	const uint8_t tk1[TWEAKEYBYTES]);
+
+/**
+ * Skinny-128-128 simple (i.e. without operating mode) encryption function,
+ * either with the round tweakeys precomputed by 'tk_schedule_1' or computed
+ * on-the-fly ('_otf', for single-use keys).
+ */
+void skinny128_128(
+	uint8_t out[BLOCKBYTES], const uint8_t in[BLOCKBYTES],
+	const uint8_t rtk[SKINNY128_128_ROUNDS*BLOCKBYTES/2]);
+
+void skinny128_128_otf(
+	uint8_t out[BLOCKBYTES], const uint8_t in[BLOCKBYTES],
+	const uint8_t tk1[TWEAKEYBYTES]);
+
+/**
+ * Precomputation of the round tweakeys for TK2 of Skinny-128-256 (also
+ * include a part of the round constants).
+ */
+void tk_schedule_2(
+	uint8_t rtk_2[SKINNY128_256_ROUNDS*BLOCKBYTES/2],
+	const uint8_t tk2[TWEAKEYBYTES]);
+
+/**
+ * Skinny-128-256 simple (i.e. without operating mode) encryption function.
+ * The tweakey schedule for TK1 is computed on-the-fly while it is assumed to
+ * be precomputed for TK2 by 'tk_schedule_2', unless the whole schedule is
+ * computed on-the-fly ('_otf').
+ */
+void skinny128_256(
+	uint8_t out[BLOCKBYTES], const uint8_t in[BLOCKBYTES],
+	const uint8_t tk1[TWEAKEYBYTES],
+	const uint8_t rtk_2[SKINNY128_256_ROUNDS*BLOCKBYTES/2]);
+
+void skinny128_256_otf(
+	uint8_t out[BLOCKBYTES], const uint8_t in[BLOCKBYTES],
+	const uint8_t tk1[TWEAKEYBYTES],
+	const uint8_t tk2[TWEAKEYBYTES]);
+
+/**
+ * Skinny-128-256 decryption function, taking the same round tweakeys as
+ * 'skinny128_256'.
+ */
+void skinny128_256_inv(
+	uint8_t out[BLOCKBYTES], const uint8_t in[BLOCKBYTES],
+	const uint8_t tk1[TWEAKEYBYTES],
+	const uint8_t rtk_2[SKINNY128_256_ROUNDS*BLOCKBYTES/2]);
+
+/**
+ * Three independent Skinny-128-256 encryptions, each one with its own TK1 and
+ * TK2 round tweakeys, with their instructions interleaved.
+ */
+void skinny128_256_x3(
+	uint8_t out_0[BLOCKBYTES], const uint8_t in_0[BLOCKBYTES],
+	const uint8_t tk1_0[TWEAKEYBYTES],
+	const uint8_t rtk_2_0[SKINNY128_256_ROUNDS*BLOCKBYTES/2],
+	uint8_t out_1[BLOCKBYTES], const uint8_t in_1[BLOCKBYTES],
+	const uint8_t tk1_1[TWEAKEYBYTES],
+	const uint8_t rtk_2_1[SKINNY128_256_ROUNDS*BLOCKBYTES/2],
+	uint8_t out_2[BLOCKBYTES], const uint8_t in_2[BLOCKBYTES],
+	const uint8_t tk1_2[TWEAKEYBYTES],
+	const uint8_t rtk_2_2[SKINNY128_256_ROUNDS*BLOCKBYTES/2]);
+
+#if defined(__AVX2__)
+/**
+ * AVX2 encryption of two consecutive blocks, sharing the precomputed round
+ * tweakeys of Skinny-128-128 (resp. of TK2 for Skinny-128-256 and of TK2/TK3
+ * for Skinny-128-384, each block having its own TK1).
+ */
+void skinny128_128_x2(
+	uint8_t out[2*BLOCKBYTES], const uint8_t in[2*BLOCKBYTES],
+	const uint8_t rtk[SKINNY128_128_ROUNDS*BLOCKBYTES/2]);
+
+void skinny128_256_x2(
+	uint8_t out[2*BLOCKBYTES], const uint8_t in[2*BLOCKBYTES],
+	const uint8_t tk1_0[TWEAKEYBYTES], const uint8_t tk1_1[TWEAKEYBYTES],
+	const uint8_t rtk_2[SKINNY128_256_ROUNDS*BLOCKBYTES/2]);
+
+void skinny128_384_x2(
+	uint8_t out[2*BLOCKBYTES], const uint8_t in[2*BLOCKBYTES],
+	const uint8_t tk1_0[TWEAKEYBYTES], const uint8_t tk1_1[TWEAKEYBYTES],
+	const uint8_t rtk_23[SKINNY128_384_FULL_ROUNDS*BLOCKBYTES/2]);
+
+/**
+ * AVX2 decryption of two consecutive blocks under the same tweakeys as
+ * 'skinny128_256_x2' (resp. 'skinny128_384_x2').
+ */
+void skinny128_256_inv_x2(
+	uint8_t out[2*BLOCKBYTES], const uint8_t in[2*BLOCKBYTES],
+	const uint8_t tk1_0[TWEAKEYBYTES], const uint8_t tk1_1[TWEAKEYBYTES],
+	const uint8_t rtk_2[SKINNY128_256_ROUNDS*BLOCKBYTES/2]);
+
+void skinny128_384_inv_x2(
+	uint8_t out[2*BLOCKBYTES], const uint8_t in[2*BLOCKBYTES],
+	const uint8_t tk1_0[TWEAKEYBYTES], const uint8_t tk1_1[TWEAKEYBYTES],
+	const uint8_t rtk_23[SKINNY128_384_FULL_ROUNDS*BLOCKBYTES/2]);
+#endif
@@ -0,0 +1,137 @@
+/******************************************************************************
+* Analytical cost model of the Romulus variants (see 'romulus_cost.h').
+*
+* Each function below mirrors the control flow of the corresponding mode
+* implementation, only keeping track of the lengths.
+*
+* @date		October 2026
+******************************************************************************/
+#include "romulus_cost.h"
+
+#define BLOCKBYTES 	16
+
+/******************************************************************************
+* Number of 16-byte blocks (including a partial one) in 'len' bytes, or 1 if
+* 'len' is null (i.e. a single padded block).
+******************************************************************************/
+static uint64_t nblocks(unsigned long long len) {
+	return (len == 0) ? 1 : (len + BLOCKBYTES - 1) / BLOCKBYTES;
+}
+
+/******************************************************************************
+* Romulus-N: AD is absorbed at rate 2 (i.e. 1 call per double block + a final
+* call with the nonce), then 1 call per message block.
+******************************************************************************/
+static void cost_n(romulus_cost_t *cost,
+	unsigned long long adlen, unsigned long long mlen) {
+	uint64_t ad_calls = (adlen + BLOCKBYTES - 1) / BLOCKBYTES / 2 + 1;
+	cost->skinny = ad_calls + nblocks(mlen);
+	cost->tk_schedule_23 = ad_calls;
+}
+
+/******************************************************************************
+* Romulus-M: the MAC absorbs AD and message as double blocks (the first message
+* block completing an odd AD), then the message is encrypted with 1 call per
+* block using the round tweakeys of the last MAC call.
+******************************************************************************/
+static void cost_m(romulus_cost_t *cost,
+	unsigned long long adlen, unsigned long long mlen) {
+	uint64_t calls = 0;
+	unsigned long long m = mlen;
+	while (adlen > 2*BLOCKBYTES) {
+		calls++;
+		adlen -= 2*BLOCKBYTES;
+	}
+	if (adlen > BLOCKBYTES) {				// complete/partial double block
+		calls++;
+	} else {								// single block completed by M
+		calls++;
+		m = (m >= BLOCKBYTES) ? m - BLOCKBYTES : 0;
+	}
+	while (m > 2*BLOCKBYTES) {
+		calls++;
+		m -= 2*BLOCKBYTES;
+	}
+	if (m > BLOCKBYTES)
+		calls++;
+	calls++;								// final call with the nonce
+	cost->skinny = calls + ((mlen == 0) ? 0 : nblocks(mlen));
+	cost->tk_schedule_23 = calls;
+}
+
+/******************************************************************************
+* Number of Hirose compression calls in the Romulus-T hash of (A, C).
+******************************************************************************/
+static uint64_t hirose_calls_t(unsigned long long adlen, unsigned long long clen) {
+	uint64_t calls = 0;
+	int adempty = (adlen == 0), cempty = (clen == 0);
+	while (adlen >= 2*BLOCKBYTES) {
+		calls++;
+		adlen -= 2*BLOCKBYTES;
+	}
+	if (adlen >= BLOCKBYTES) {
+		calls++;
+	} else if (!adempty) {
+		calls++;
+		if (clen >= BLOCKBYTES) {
+			clen -= BLOCKBYTES;
+		} else if (clen > 0) {
+			clen = 0;
+			cempty = 1;
+		}
+	}
+	while (clen >= 2*BLOCKBYTES) {
+		calls++;
+		clen -= 2*BLOCKBYTES;
+	}
+	if (clen >= BLOCKBYTES || !cempty)
+		calls++;
+	return calls + 1;						// final call with nonce/counter
+}
+
+/******************************************************************************
+* Romulus-T: 1 call for the key derivation, 2 calls per message block (except
+* the last one), 2 calls per Hirose compression and 1 call for the tag.
+******************************************************************************/
+static void cost_t(romulus_cost_t *cost,
+	unsigned long long adlen, unsigned long long mlen) {
+	uint64_t h = hirose_calls_t(adlen, mlen);
+	uint64_t n = nblocks(mlen);
+	cost->skinny = 1 + (2*n - 1) + 2*h + 1;
+	cost->tk_schedule_23 = h + 1;
+	cost->tk_schedule_3 = 1 + n;
+}
+
+/******************************************************************************
+* Romulus-H: 1 Hirose compression (i.e. 2 calls) per 32-byte block, the last
+* one being padded.
+******************************************************************************/
+static void cost_h(romulus_cost_t *cost, unsigned long long inlen) {
+	uint64_t h = inlen / (2*BLOCKBYTES) + 1;
+	cost->skinny = 2*h;
+	cost->tk_schedule_23 = h;
+}
+
+romulus_cost_t romulus_cost(romulus_variant variant,
+	unsigned long long adlen, unsigned long long mlen) {
+	romulus_cost_t cost = {0, 0, 0};
+	switch (variant) {
+		case ROMULUS_N: cost_n(&cost, adlen, mlen); break;
+		case ROMULUS_M: cost_m(&cost, adlen, mlen); break;
+		case ROMULUS_T: cost_t(&cost, adlen, mlen); break;
+		case ROMULUS_H: cost_h(&cost, mlen); break;
+	}
+	return cost;
+}
+
+double romulus_cost_cycles(const romulus_cost_model *model,
+	romulus_variant variant, unsigned long long adlen, unsigned long long mlen) {
+	romulus_cost_t cost = romulus_cost(variant, adlen, mlen);
+	if (variant == ROMULUS_H)
+		adlen = 0;
+	return model->skinny * (double)cost.skinny
+		+ model->tk_schedule_23 * (double)cost.tk_schedule_23
+		+ model->tk_schedule_3 * (double)cost.tk_schedule_3
+		+ model->per_byte * (double)(adlen + mlen)
+		+ model->per_call;
+}
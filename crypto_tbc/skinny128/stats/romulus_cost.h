@@ -0,0 +1,53 @@
+/******************************************************************************
+* Analytical cost model of the Romulus variants.
+*
+* 'romulus_cost' returns the exact number of Skinny-128-384+ calls and TK2/TK3
+* tweakey schedule expansions performed by the implementations in this
+* repository for a given (adlen, mlen), without running them. Together with a
+* per-backend calibration (see 'bench/cost.sh'), 'romulus_cost_cycles' turns
+* these counts into a cycle estimate, e.g. for load balancing purposes.
+*
+* @date		October 2026
+******************************************************************************/
+#ifndef ROMULUS_COST_H_
+#define ROMULUS_COST_H_
+
+#include <stdint.h>
+
+typedef enum {
+	ROMULUS_N,
+	ROMULUS_M,
+	ROMULUS_T,
+	ROMULUS_H		// 'mlen' is the input length, 'adlen' is ignored
+} romulus_variant;
+
+typedef struct {
+	uint64_t skinny;			// Skinny-128-384+ calls
+	uint64_t tk_schedule_23;	// TK2/TK3 round tweakeys expansions
+	uint64_t tk_schedule_3;		// TK3 round tweakeys expansions (Romulus-T)
+} romulus_cost_t;
+
+// Backend-specific cycle counts, as output by 'bench/cost.sh'
+typedef struct {
+	double skinny;
+	double tk_schedule_23;
+	double tk_schedule_3;
+	double per_byte;			// mode glue cost per byte of AD/message
+	double per_call;			// fixed cost per encryption/hash
+} romulus_cost_model;
+
+/******************************************************************************
+* Number of Skinny calls and schedule expansions to encrypt (or hash) a message
+* of 'mlen' bytes with 'adlen' bytes of AD. Decryption has the same cost,
+* except for Romulus-M which performs an additional TK2/TK3 expansion.
+******************************************************************************/
+romulus_cost_t romulus_cost(romulus_variant variant,
+	unsigned long long adlen, unsigned long long mlen);
+
+/******************************************************************************
+* Predicted number of cycles according to the calibrated model 'model'.
+******************************************************************************/
+double romulus_cost_cycles(const romulus_cost_model *model,
+	romulus_variant variant, unsigned long long adlen, unsigned long long mlen);
+
+#endif  // ROMULUS_COST_H_
@@ -0,0 +1,65 @@
+/******************************************************************************
+* Thread-local counters used when compiling with -DSKINNY_STATS (see
+* 'skinny_stats.h').
+*
+* @date		October 2026
+******************************************************************************/
+#include "skinny_stats.h"
+
+#if defined(SKINNY_STATS)
+_Thread_local skinny_stats_counter skinny_stats[SKINNY_STATS_NB];
+
+static const char *skinny_stats_names[SKINNY_STATS_NB] = {
+	"crypto_aead_encrypt",
+	"crypto_aead_decrypt",
+	"crypto_hash",
+	"skinny (blocks)",
+	"skinny_inv (blocks)",
+	"tk_schedule_1",
+	"tk_update_1",
+	"tk_schedule_23",
+	"tk_schedule_3",
+};
+
+/******************************************************************************
+* Print the counters of the calling thread. When cycles are measured, the time
+* spent in the mode glue is estimated as the time spent in the entry points
+* minus the time spent in the Skinny and tweakey schedule functions.
+******************************************************************************/
+void skinny_stats_dump(FILE *f) {
+	uint64_t total = 0, kernels = 0;
+	for(int i = 0; i < SKINNY_STATS_NB; i++) {
+		if (i <= SKINNY_STATS_HASH)
+			total += skinny_stats[i].cycles;
+		else
+			kernels += skinny_stats[i].cycles;
+		if (skinny_stats[i].calls == 0)
+			continue;
+		fprintf(f, "%-22s %12llu calls", skinny_stats_names[i],
+			(unsigned long long)skinny_stats[i].calls);
+#if defined(SKINNY_STATS_CYCLES)
+		fprintf(f, " %16llu cycles %10.1f cycles/call",
+			(unsigned long long)skinny_stats[i].cycles,
+			(double)skinny_stats[i].cycles / (double)skinny_stats[i].calls);
+#endif
+		fprintf(f, "\n");
+	}
+#if defined(SKINNY_STATS_CYCLES)
+	if (total >= kernels)
+		fprintf(f, "%-22s %35llu cycles\n", "mode glue",
+			(unsigned long long)(total - kernels));
+#endif
+}
+
+/******************************************************************************
+* Reset the counters of the calling thread.
+******************************************************************************/
+void skinny_stats_reset(void) {
+	for(int i = 0; i < SKINNY_STATS_NB; i++) {
+		skinny_stats[i].calls = 0;
+		skinny_stats[i].cycles = 0;
+	}
+}
+#else
+typedef int skinny_stats_unused;	// avoid an empty translation unit
+#endif
@@ -0,0 +1,72 @@
+/******************************************************************************
+* Optional instrumentation of the hot paths of the Romulus and SKINNY-AEAD
+* implementations.
+*
+* When compiled with -DSKINNY_STATS, the number of calls to the AEAD/hash entry
+* points, Skinny encryptions/decryptions (counted in blocks) and tweakey
+* schedule expansions are recorded in thread-local counters, which can be
+* printed with 'skinny_stats_dump'. With -DSKINNY_STATS_CYCLES, the cycles
+* spent in each instrumented function are recorded as well.
+* Without SKINNY_STATS, all the macros below expand to nothing.
+*
+* @date		October 2026
+******************************************************************************/
+#ifndef SKINNY_STATS_H_
+#define SKINNY_STATS_H_
+
+#if defined(SKINNY_STATS)
+#include <stdint.h>
+#include <stdio.h>
+
+enum skinny_stats_id {
+	SKINNY_STATS_ENCRYPT,			// crypto_aead_encrypt
+	SKINNY_STATS_DECRYPT,			// crypto_aead_decrypt
+	SKINNY_STATS_HASH,				// crypto_hash
+	SKINNY_STATS_SKINNY,			// Skinny encryptions (in blocks)
+	SKINNY_STATS_SKINNY_INV,		// Skinny decryptions (in blocks)
+	SKINNY_STATS_TK_SCHEDULE_1,		// TK1 round tweakeys expansions
+	SKINNY_STATS_TK_UPDATE_1,		// in-place TK1 counter updates
+	SKINNY_STATS_TK_SCHEDULE_23,	// TK2/TK3 round tweakeys expansions
+	SKINNY_STATS_TK_SCHEDULE_3,		// TK3 round tweakeys expansions
+	SKINNY_STATS_NB
+};
+
+typedef struct {
+	uint64_t calls;
+	uint64_t cycles;
+} skinny_stats_counter;
+
+extern _Thread_local skinny_stats_counter skinny_stats[SKINNY_STATS_NB];
+
+void skinny_stats_dump(FILE *f);
+void skinny_stats_reset(void);
+
+#if defined(SKINNY_STATS_CYCLES)
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define skinny_stats_cycles()	__rdtsc()
+#else
+#include <time.h>
+static inline uint64_t skinny_stats_cycles(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+#endif
+// add 'n' to the counter 'id' and start measuring the cycles
+#define SKINNY_STATS_BEGIN(id, n)										\
+	const uint64_t skinny_stats_start_##id = skinny_stats_cycles();	\
+	skinny_stats[id].calls += (n)
+#define SKINNY_STATS_END(id)											\
+	(skinny_stats[id].cycles += skinny_stats_cycles() - skinny_stats_start_##id)
+#else
+#define SKINNY_STATS_BEGIN(id, n)	(skinny_stats[id].calls += (n))
+#define SKINNY_STATS_END(id)		((void)0)
+#endif
+
+#else
+#define SKINNY_STATS_BEGIN(id, n)
+#define SKINNY_STATS_END(id)
+#endif
+
+#endif  // SKINNY_STATS_H_
@@ -0,0 +1,376 @@
+/*******************************************************************************
+* Public interface of libskinny.
+*
+* Every backend of every variant is compiled into the library with its own
+* symbols: the SUPERCOP entry points 'crypto_aead_encrypt'/'crypto_aead_decrypt'
+* and 'crypto_hash' are exposed as '<variant>_<backend>_encrypt',
+* '<variant>_<backend>_decrypt' and '<variant>_<backend>_hash' (e.g.
+* 'romulusn_x86_encrypt' or 'romulush_opt32_hash'), with the same semantics.
+* The Romulus AEAD backends also provide '<variant>_<backend>_encrypt_detached'
+* and '<variant>_<backend>_decrypt_detached', where the tag has its own buffer
+* and the output may overwrite the input (in-place operation). Whatever the
+* backend, a decryption whose tag verification fails returns -1 and zeroizes
+* its output, so that no unverified plaintext is released. The Romulus-N
+* 'opt32', 'opt32_redundant' and 'x86' backends provide scatter-gather variants
+* '<variant>_<backend>_encrypt_iov'/'<variant>_<backend>_decrypt_iov' as well
+* (see 'romulus_iov.h' for their semantics) when SKINNY_HAVE_IOV is defined,
+* and the online STREAM interface '<variant>_<backend>_stream_*' (see
+* 'romulus_stream.h').
+* The bulk Skinny-128-384 backends provide '<variant>_<backend>_key_setup',
+* '<variant>_<backend>_encrypt_many' and '<variant>_<backend>_decrypt_many'
+* (e.g. 'skinny128_384_x86_encrypt_many', see 'skinny128_bulk.h'), where the
+* key context must be set up by the same backend.
+* Similarly, the Skinny-128-256 sector encryption backends provide
+* '<variant>_<backend>_key_setup', '<variant>_<backend>_encrypt',
+* '<variant>_<backend>_decrypt', their '_at' variants and, when
+* SKINNY_HAVE_THREADS is defined, their multi-threaded '_mt' variants (e.g.
+* 'skinny_sector_x86_encrypt_mt', see 'skinny_sector.h').
+* SKINNY_HAVE_<VARIANT>_<BACKEND> is defined for each backend available in the
+* build (see 'skinny_config.h').
+*
+* For convenience, '<variant>_encrypt'/'<variant>_decrypt'/'<variant>_hash'
+* refer to the fastest backend available for the target.
+*
+* @date		October 2026
+*******************************************************************************/
+#ifndef SKINNY_H_
+#define SKINNY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "skinny_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct iovec;
+
+#define ROMULUS_KEYBYTES		16
+#define ROMULUS_NPUBBYTES		16
+#define ROMULUS_ABYTES			16
+#define ROMULUSH_BYTES			32
+#define SKINNYAEAD_KEYBYTES		16
+#define SKINNYAEAD_NPUBBYTES	16
+#define SKINNYAEAD_ABYTES		16
+#define ROMULUSN_STREAM_PREFIXBYTES	11
+
+// Romulus-N STREAM state, same layout as in 'romulus_stream.h' (checked at
+// build time by 'cmake/skinny_abi.c', as the contexts below)
+typedef struct {
+	unsigned char k[ROMULUS_KEYBYTES];
+	unsigned char prefix[ROMULUSN_STREAM_PREFIXBYTES];
+	unsigned char status;
+	uint32_t index;
+} romulusn_stream;
+
+#define SKINNY128_384_KEYBYTES		32
+#define SKINNY128_384_TWEAKBYTES	16
+
+// Skinny-128-384 key context, same layout as in 'skinny128_bulk.h'
+typedef struct {
+	uint32_t rtk_23[8*56];
+} skinny128_384_key;
+
+#define SKINNY_SECTOR_KEYBYTES		16
+#define SKINNY_SECTOR_BLOCKBYTES	16
+
+// Sector encryption key context, same layout as in 'skinny_sector.h'
+typedef struct {
+	uint32_t rtk_2[8*48];
+} skinny_sector_key;
+
+#define SKINNY_DECLARE_AEAD(name)											\
+	int name##_encrypt(unsigned char *c, unsigned long long *clen,			\
+		const unsigned char *m, unsigned long long mlen,					\
+		const unsigned char *ad, unsigned long long adlen,					\
+		const unsigned char *nsec, const unsigned char *npub,				\
+		const unsigned char *k);											\
+	int name##_decrypt(unsigned char *m, unsigned long long *mlen,			\
+		unsigned char *nsec,												\
+		const unsigned char *c, unsigned long long clen,					\
+		const unsigned char *ad, unsigned long long adlen,					\
+		const unsigned char *npub, const unsigned char *k);
+
+#define SKINNY_DECLARE_ROMULUS(name)										\
+	SKINNY_DECLARE_AEAD(name)												\
+	int name##_encrypt_detached(unsigned char *c, unsigned char *tag,		\
+		const unsigned char *m, unsigned long long mlen,					\
+		const unsigned char *ad, unsigned long long adlen,					\
+		const unsigned char *npub, const unsigned char *k);					\
+	int name##_decrypt_detached(unsigned char *m,							\
+		const unsigned char *c, unsigned long long clen,					\
+		const unsigned char *tag,											\
+		const unsigned char *ad, unsigned long long adlen,					\
+		const unsigned char *npub, const unsigned char *k);
+
+#define SKINNY_DECLARE_IOV(name)											\
+	int name##_encrypt_iov(const struct iovec *ad, int adcnt,				\
+		const struct iovec *in, int incnt,									\
+		const struct iovec *out, int outcnt, unsigned char *tag,			\
+		const unsigned char *npub, const unsigned char *k);					\
+	int name##_decrypt_iov(const struct iovec *ad, int adcnt,				\
+		const struct iovec *in, int incnt,									\
+		const struct iovec *out, int outcnt, const unsigned char *tag,		\
+		const unsigned char *npub, const unsigned char *k);
+
+#define SKINNY_DECLARE_STREAM(name)											\
+	void name##_stream_init(romulusn_stream *st,							\
+		const unsigned char *k, const unsigned char *nonce_prefix);			\
+	int name##_stream_seal_segment(romulusn_stream *st,						\
+		unsigned char *c, unsigned char *tag,								\
+		const unsigned char *m, unsigned long long mlen,					\
+		const unsigned char *ad, unsigned long long adlen, int last);		\
+	int name##_stream_open_segment(romulusn_stream *st,						\
+		unsigned char *m,													\
+		const unsigned char *c, unsigned long long clen,					\
+		const unsigned char *tag,											\
+		const unsigned char *ad, unsigned long long adlen, int last);		\
+	int name##_stream_seal_segment_at(const romulusn_stream *st,			\
+		uint32_t index, unsigned char *c, unsigned char *tag,				\
+		const unsigned char *m, unsigned long long mlen,					\
+		const unsigned char *ad, unsigned long long adlen, int last);		\
+	int name##_stream_open_segment_at(const romulusn_stream *st,			\
+		uint32_t index, unsigned char *m,									\
+		const unsigned char *c, unsigned long long clen,					\
+		const unsigned char *tag,											\
+		const unsigned char *ad, unsigned long long adlen, int last);
+
+#define SKINNY_DECLARE_BULK(name)											\
+	void name##_key_setup(skinny128_384_key *ctx, const unsigned char *k);	\
+	void name##_encrypt_many(unsigned char *out, const unsigned char *in,	\
+		const unsigned char *tweaks, size_t n,								\
+		const skinny128_384_key *ctx);										\
+	void name##_decrypt_many(unsigned char *out, const unsigned char *in,	\
+		const unsigned char *tweaks, size_t n,								\
+		const skinny128_384_key *ctx);
+
+#define SKINNY_DECLARE_SECTOR(name)											\
+	void name##_key_setup(skinny_sector_key *ctx, const unsigned char *k);	\
+	int name##_encrypt(const skinny_sector_key *ctx, uint64_t sector,		\
+		unsigned char *buf, size_t len);									\
+	int name##_decrypt(const skinny_sector_key *ctx, uint64_t sector,		\
+		unsigned char *buf, size_t len);									\
+	int name##_encrypt_at(const skinny_sector_key *ctx, uint64_t sector,	\
+		uint64_t block, unsigned char *buf, size_t len);					\
+	int name##_decrypt_at(const skinny_sector_key *ctx, uint64_t sector,	\
+		uint64_t block, unsigned char *buf, size_t len);
+
+#define SKINNY_DECLARE_SECTOR_MT(name)										\
+	int name##_encrypt_mt(const skinny_sector_key *ctx, uint64_t sector,	\
+		size_t sector_size, unsigned char *buf, size_t len, int threads);	\
+	int name##_decrypt_mt(const skinny_sector_key *ctx, uint64_t sector,	\
+		size_t sector_size, unsigned char *buf, size_t len, int threads);
+
+#define SKINNY_DECLARE_HASH(name)											\
+	int name##_hash(unsigned char *out,										\
+		const unsigned char *in, unsigned long long inlen);
+
+#ifdef SKINNY_HAVE_ROMULUSN_OPT32
+SKINNY_DECLARE_ROMULUS(romulusn_opt32)
+SKINNY_DECLARE_STREAM(romulusn_opt32)
+#ifdef SKINNY_HAVE_IOV
+SKINNY_DECLARE_IOV(romulusn_opt32)
+#endif
+#endif
+#ifdef SKINNY_HAVE_ROMULUSN_OPT32_REDUNDANT
+SKINNY_DECLARE_ROMULUS(romulusn_opt32_redundant)
+SKINNY_DECLARE_STREAM(romulusn_opt32_redundant)
+#ifdef SKINNY_HAVE_IOV
+SKINNY_DECLARE_IOV(romulusn_opt32_redundant)
+#endif
+#endif
+#ifdef SKINNY_HAVE_ROMULUSN_X86
+SKINNY_DECLARE_ROMULUS(romulusn_x86)
+SKINNY_DECLARE_STREAM(romulusn_x86)
+#ifdef SKINNY_HAVE_IOV
+SKINNY_DECLARE_IOV(romulusn_x86)
+#endif
+#endif
+#ifdef SKINNY_HAVE_ROMULUSN_ARMV7A
+SKINNY_DECLARE_ROMULUS(romulusn_armv7a)
+#endif
+#ifdef SKINNY_HAVE_ROMULUSN_ARMV8A
+SKINNY_DECLARE_ROMULUS(romulusn_armv8a)
+#endif
+
+#ifdef SKINNY_HAVE_ROMULUSM_OPT32
+SKINNY_DECLARE_ROMULUS(romulusm_opt32)
+#endif
+#ifdef SKINNY_HAVE_ROMULUSM_OPT32_REDUNDANT
+SKINNY_DECLARE_ROMULUS(romulusm_opt32_redundant)
+#endif
+#ifdef SKINNY_HAVE_ROMULUSM_X86
+SKINNY_DECLARE_ROMULUS(romulusm_x86)
+#endif
+#ifdef SKINNY_HAVE_ROMULUSM_ARMV7A
+SKINNY_DECLARE_ROMULUS(romulusm_armv7a)
+#endif
+#ifdef SKINNY_HAVE_ROMULUSM_ARMV8A
+SKINNY_DECLARE_ROMULUS(romulusm_armv8a)
+#endif
+
+#ifdef SKINNY_HAVE_ROMULUST_OPT32
+SKINNY_DECLARE_ROMULUS(romulust_opt32)
+#endif
+#ifdef SKINNY_HAVE_ROMULUST_X86
+SKINNY_DECLARE_ROMULUS(romulust_x86)
+#endif
+#ifdef SKINNY_HAVE_ROMULUST_ARMV7A
+SKINNY_DECLARE_ROMULUS(romulust_armv7a)
+#endif
+#ifdef SKINNY_HAVE_ROMULUST_ARMV8A
+SKINNY_DECLARE_ROMULUS(romulust_armv8a)
+#endif
+
+#ifdef SKINNY_HAVE_ROMULUSH_OPT32
+SKINNY_DECLARE_HASH(romulush_opt32)
+#endif
+#ifdef SKINNY_HAVE_ROMULUSH_X86
+SKINNY_DECLARE_HASH(romulush_x86)
+#endif
+#ifdef SKINNY_HAVE_ROMULUSH_AVX2
+SKINNY_DECLARE_HASH(romulush_avx2)
+#endif
+#ifdef SKINNY_HAVE_ROMULUSH_ARMV7A
+SKINNY_DECLARE_HASH(romulush_armv7a)
+#endif
+#ifdef SKINNY_HAVE_ROMULUSH_ARMV8A
+SKINNY_DECLARE_HASH(romulush_armv8a)
+#endif
+
+#ifdef SKINNY_HAVE_SKINNYAEADM1_OPT32
+SKINNY_DECLARE_AEAD(skinnyaeadm1_opt32)
+#endif
+#ifdef SKINNY_HAVE_SKINNYAEADM1PLUS_OPT32
+SKINNY_DECLARE_AEAD(skinnyaeadm1plus_opt32)
+#endif
+#ifdef SKINNY_HAVE_SKINNYAEADM1_X86
+SKINNY_DECLARE_AEAD(skinnyaeadm1_x86)
+#endif
+#ifdef SKINNY_HAVE_SKINNYAEADM1PLUS_X86
+SKINNY_DECLARE_AEAD(skinnyaeadm1plus_x86)
+#endif
+
+#ifdef SKINNY_HAVE_SKINNY128_384_OPT32
+SKINNY_DECLARE_BULK(skinny128_384_opt32)
+#endif
+#ifdef SKINNY_HAVE_SKINNY128_384_X86
+SKINNY_DECLARE_BULK(skinny128_384_x86)
+#endif
+#ifdef SKINNY_HAVE_SKINNY128_384_AVX2
+SKINNY_DECLARE_BULK(skinny128_384_avx2)
+#endif
+
+#ifdef SKINNY_HAVE_SKINNY_SECTOR_OPT32
+SKINNY_DECLARE_SECTOR(skinny_sector_opt32)
+#ifdef SKINNY_HAVE_THREADS
+SKINNY_DECLARE_SECTOR_MT(skinny_sector_opt32)
+#endif
+#endif
+#ifdef SKINNY_HAVE_SKINNY_SECTOR_X86
+SKINNY_DECLARE_SECTOR(skinny_sector_x86)
+#ifdef SKINNY_HAVE_THREADS
+SKINNY_DECLARE_SECTOR_MT(skinny_sector_x86)
+#endif
+#endif
+#ifdef SKINNY_HAVE_SKINNY_SECTOR_AVX2
+SKINNY_DECLARE_SECTOR(skinny_sector_avx2)
+#ifdef SKINNY_HAVE_THREADS
+SKINNY_DECLARE_SECTOR_MT(skinny_sector_avx2)
+#endif
+#endif
+
+/*******************************************************************************
+* Default backend of each variant: SIMD when available, opt32 otherwise.
+*******************************************************************************/
+#if defined(SKINNY_HAVE_ROMULUSN_X86)
+#define SKINNY_DEFAULT_BACKEND(variant, fn)	variant##_x86_##fn
+#elif defined(SKINNY_HAVE_ROMULUSN_ARMV8A)
+#define SKINNY_DEFAULT_BACKEND(variant, fn)	variant##_armv8a_##fn
+#elif defined(SKINNY_HAVE_ROMULUSN_ARMV7A)
+#define SKINNY_DEFAULT_BACKEND(variant, fn)	variant##_armv7a_##fn
+#else
+#define SKINNY_DEFAULT_BACKEND(variant, fn)	variant##_opt32_##fn
+#endif
+
+#define romulusn_encrypt	SKINNY_DEFAULT_BACKEND(romulusn, encrypt)
+#define romulusn_decrypt	SKINNY_DEFAULT_BACKEND(romulusn, decrypt)
+#define romulusn_encrypt_detached	SKINNY_DEFAULT_BACKEND(romulusn, encrypt_detached)
+#define romulusn_decrypt_detached	SKINNY_DEFAULT_BACKEND(romulusn, decrypt_detached)
+#if defined(SKINNY_HAVE_IOV) && defined(SKINNY_HAVE_ROMULUSN_X86)
+#define romulusn_encrypt_iov	romulusn_x86_encrypt_iov
+#define romulusn_decrypt_iov	romulusn_x86_decrypt_iov
+#elif defined(SKINNY_HAVE_IOV)
+#define romulusn_encrypt_iov	romulusn_opt32_encrypt_iov
+#define romulusn_decrypt_iov	romulusn_opt32_decrypt_iov
+#endif
+#if defined(SKINNY_HAVE_ROMULUSN_X86)
+#define romulusn_stream_init	romulusn_x86_stream_init
+#define romulusn_stream_seal_segment	romulusn_x86_stream_seal_segment
+#define romulusn_stream_open_segment	romulusn_x86_stream_open_segment
+#define romulusn_stream_seal_segment_at	romulusn_x86_stream_seal_segment_at
+#define romulusn_stream_open_segment_at	romulusn_x86_stream_open_segment_at
+#else
+#define romulusn_stream_init	romulusn_opt32_stream_init
+#define romulusn_stream_seal_segment	romulusn_opt32_stream_seal_segment
+#define romulusn_stream_open_segment	romulusn_opt32_stream_open_segment
+#define romulusn_stream_seal_segment_at	romulusn_opt32_stream_seal_segment_at
+#define romulusn_stream_open_segment_at	romulusn_opt32_stream_open_segment_at
+#endif
+#define romulusm_encrypt	SKINNY_DEFAULT_BACKEND(romulusm, encrypt)
+#define romulusm_decrypt	SKINNY_DEFAULT_BACKEND(romulusm, decrypt)
+#define romulusm_encrypt_detached	SKINNY_DEFAULT_BACKEND(romulusm, encrypt_detached)
+#define romulusm_decrypt_detached	SKINNY_DEFAULT_BACKEND(romulusm, decrypt_detached)
+#define romulust_encrypt	SKINNY_DEFAULT_BACKEND(romulust, encrypt)
+#define romulust_decrypt	SKINNY_DEFAULT_BACKEND(romulust, decrypt)
+#define romulust_encrypt_detached	SKINNY_DEFAULT_BACKEND(romulust, encrypt_detached)
+#define romulust_decrypt_detached	SKINNY_DEFAULT_BACKEND(romulust, decrypt_detached)
+#define romulush_hash		SKINNY_DEFAULT_BACKEND(romulush, hash)
+#if defined(SKINNY_HAVE_SKINNYAEADM1_X86)
+#define skinnyaeadm1_encrypt		skinnyaeadm1_x86_encrypt
+#define skinnyaeadm1_decrypt		skinnyaeadm1_x86_decrypt
+#define skinnyaeadm1plus_encrypt	skinnyaeadm1plus_x86_encrypt
+#define skinnyaeadm1plus_decrypt	skinnyaeadm1plus_x86_decrypt
+#elif defined(SKINNY_HAVE_SKINNYAEADM1_OPT32)
+#define skinnyaeadm1_encrypt		skinnyaeadm1_opt32_encrypt
+#define skinnyaeadm1_decrypt		skinnyaeadm1_opt32_decrypt
+#define skinnyaeadm1plus_encrypt	skinnyaeadm1plus_opt32_encrypt
+#define skinnyaeadm1plus_decrypt	skinnyaeadm1plus_opt32_decrypt
+#endif
+// the widest multi-block kernel available
+#if defined(SKINNY_HAVE_SKINNY128_384_AVX2)
+#define skinny128_384_key_setup		skinny128_384_avx2_key_setup
+#define skinny128_384_encrypt_many	skinny128_384_avx2_encrypt_many
+#define skinny128_384_decrypt_many	skinny128_384_avx2_decrypt_many
+#elif defined(SKINNY_HAVE_SKINNY128_384_X86)
+#define skinny128_384_key_setup		skinny128_384_x86_key_setup
+#define skinny128_384_encrypt_many	skinny128_384_x86_encrypt_many
+#define skinny128_384_decrypt_many	skinny128_384_x86_decrypt_many
+#else
+#define skinny128_384_key_setup		skinny128_384_opt32_key_setup
+#define skinny128_384_encrypt_many	skinny128_384_opt32_encrypt_many
+#define skinny128_384_decrypt_many	skinny128_384_opt32_decrypt_many
+#endif
+#if defined(SKINNY_HAVE_SKINNY_SECTOR_AVX2)
+#define SKINNY_SECTOR_BACKEND(fn)	skinny_sector_avx2_##fn
+#elif defined(SKINNY_HAVE_SKINNY_SECTOR_X86)
+#define SKINNY_SECTOR_BACKEND(fn)	skinny_sector_x86_##fn
+#else
+#define SKINNY_SECTOR_BACKEND(fn)	skinny_sector_opt32_##fn
+#endif
+#define skinny_sector_key_setup		SKINNY_SECTOR_BACKEND(key_setup)
+#define skinny_sector_encrypt		SKINNY_SECTOR_BACKEND(encrypt)
+#define skinny_sector_decrypt		SKINNY_SECTOR_BACKEND(decrypt)
+#define skinny_sector_encrypt_at	SKINNY_SECTOR_BACKEND(encrypt_at)
+#define skinny_sector_decrypt_at	SKINNY_SECTOR_BACKEND(decrypt_at)
+#ifdef SKINNY_HAVE_THREADS
+#define skinny_sector_encrypt_mt	SKINNY_SECTOR_BACKEND(encrypt_mt)
+#define skinny_sector_decrypt_mt	SKINNY_SECTOR_BACKEND(decrypt_mt)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // SKINNY_H_
@@ -0,0 +1,118 @@
+/******************************************************************************
+ * Seekable chunked container sealed with Romulus-N (see 'container.h').
+ * 
+ * @date        October 2026
+ *****************************************************************************/
+#include <string.h>
+#include "container.h"
+#include "skinny.h"
+
+static void store64(uint8_t *buf, uint64_t x)
+{
+    for(int i = 0; i < 8; i++)
+        buf[i] = (uint8_t)(x >> 8*i);
+}
+
+static uint64_t load64(const uint8_t *buf)
+{
+    uint64_t x = 0;
+    for(int i = 7; i >= 0; i--)
+        x = (x << 8) | buf[i];
+    return x;
+}
+
+static uint64_t nchunks(uint32_t chunk_size, uint64_t length)
+{
+    return (length == 0) ? 1 : (length - 1) / chunk_size + 1;
+}
+
+int container_header_init(container_header *hdr, uint32_t chunk_size,
+    uint64_t length, const uint8_t base_nonce[CONTAINER_NONCEBYTES])
+{
+    if (chunk_size == 0)
+        return -1;
+    hdr->chunk_size = chunk_size;
+    hdr->length = length;
+    hdr->nchunks = nchunks(chunk_size, length);
+    memcpy(hdr->base_nonce, base_nonce, CONTAINER_NONCEBYTES);
+    memset(hdr->raw, 0x00, CONTAINER_HEADERBYTES);
+    memcpy(hdr->raw, CONTAINER_MAGIC, 8);
+    hdr->raw[8] = CONTAINER_VERSION;
+    hdr->raw[12] = (uint8_t)chunk_size;
+    hdr->raw[13] = (uint8_t)(chunk_size >> 8);
+    hdr->raw[14] = (uint8_t)(chunk_size >> 16);
+    hdr->raw[15] = (uint8_t)(chunk_size >> 24);
+    store64(hdr->raw + 16, length);
+    memcpy(hdr->raw + 24, base_nonce, CONTAINER_NONCEBYTES);
+    return 0;
+}
+
+int container_header_parse(container_header *hdr, const uint8_t *buf,
+    uint64_t size)
+{
+    uint32_t chunk_size;
+    uint64_t length;
+    if (size < CONTAINER_HEADERBYTES || memcmp(buf, CONTAINER_MAGIC, 8) ||
+        buf[8] != CONTAINER_VERSION || buf[9] || buf[10] || buf[11])
+        return -1;
+    chunk_size = (uint32_t)buf[12] | ((uint32_t)buf[13] << 8) |
+        ((uint32_t)buf[14] << 16) | ((uint32_t)buf[15] << 24);
+    length = load64(buf + 16);
+    if (container_header_init(hdr, chunk_size, length, buf + 24))
+        return -1;
+    // the sizes must match exactly, while avoiding overflows
+    if (length > size || hdr->nchunks > (size - length) / CONTAINER_TAGBYTES)
+        return -1;
+    return (container_size(hdr) == size) ? 0 : -1;
+}
+
+uint64_t container_data_offset(const container_header *hdr)
+{
+    return CONTAINER_HEADERBYTES + CONTAINER_TAGBYTES*hdr->nchunks;
+}
+
+uint64_t container_size(const container_header *hdr)
+{
+    return container_data_offset(hdr) + hdr->length;
+}
+
+size_t container_chunk_len(const container_header *hdr, uint64_t i)
+{
+    uint64_t off = i * hdr->chunk_size;
+    uint64_t len = hdr->length - off;
+    return (size_t)((len < hdr->chunk_size) ? len : hdr->chunk_size);
+}
+
+/**
+ * Nonce and associated data of chunk 'i'.
+ */
+static void chunk_params(const container_header *hdr, uint64_t i,
+    uint8_t npub[ROMULUS_NPUBBYTES], uint8_t ad[CONTAINER_HEADERBYTES+1])
+{
+    memcpy(npub, hdr->base_nonce, CONTAINER_NONCEBYTES);
+    store64(npub + CONTAINER_NONCEBYTES, i);
+    memcpy(ad, hdr->raw, CONTAINER_HEADERBYTES);
+    ad[CONTAINER_HEADERBYTES] = (i == hdr->nchunks - 1);
+}
+
+void container_seal_chunk(const container_header *hdr,
+    const uint8_t key[CONTAINER_KEYBYTES], uint64_t i,
+    uint8_t *c, uint8_t tag[CONTAINER_TAGBYTES], const uint8_t *m)
+{
+    uint8_t npub[ROMULUS_NPUBBYTES];
+    uint8_t ad[CONTAINER_HEADERBYTES+1];
+    chunk_params(hdr, i, npub, ad);
+    romulusn_encrypt_detached(c, tag, m, container_chunk_len(hdr, i),
+        ad, sizeof(ad), npub, key);
+}
+
+int container_open_chunk(const container_header *hdr,
+    const uint8_t key[CONTAINER_KEYBYTES], uint64_t i,
+    uint8_t *m, const uint8_t *c, const uint8_t tag[CONTAINER_TAGBYTES])
+{
+    uint8_t npub[ROMULUS_NPUBBYTES];
+    uint8_t ad[CONTAINER_HEADERBYTES+1];
+    chunk_params(hdr, i, npub, ad);
+    return romulusn_decrypt_detached(m, c, container_chunk_len(hdr, i),
+        tag, ad, sizeof(ad), npub, key);
+}
@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Seekable chunked container sealed with Romulus-N.
+ * 
+ * A container encrypts a file of 'length' bytes split into chunks of
+ * 'chunk_size' bytes (the last one may be shorter or even empty), each chunk
+ * being sealed independently so that chunks can be processed in parallel and
+ * any byte range can be decrypted without touching the rest of the file.
+ * All integers are little-endian.
+ * 
+ *   offset  size          content
+ *   0       32            header
+ *   32      16*nchunks    chunk index table: tag of chunk i at 32 + 16*i
+ *   d       length        ciphertext: chunk i at d + i*chunk_size, where
+ *                         d = 32 + 16*nchunks
+ * 
+ * with nchunks = max(1, ceil(length / chunk_size)) and the header being
+ * 
+ *   0       8             magic "ROMULUSC"
+ *   8       1             version (1)
+ *   9       3             reserved (0)
+ *   12      4             chunk_size (non-zero)
+ *   16      8             length
+ *   24      8             base nonce (random, never reused with the same key)
+ * 
+ * Chunk i is encrypted with Romulus-N under the 16-byte key with
+ * nonce = base nonce || i (64-bit) and associated data = header || final,
+ * 'final' being a byte set to 1 for the last chunk and to 0 otherwise. Since
+ * the header is authenticated along with every chunk, any modification of the
+ * chunk size, length or nonce as well as truncation, extension and reordering
+ * of chunks are detected. Ciphertext chunks have the same size as plaintext
+ * ones thanks to the detached tags, so that plaintext offsets map directly to
+ * ciphertext offsets.
+ * 
+ * @date        October 2026
+ *****************************************************************************/
+#ifndef CONTAINER_H_
+#define CONTAINER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define CONTAINER_MAGIC         "ROMULUSC"
+#define CONTAINER_VERSION       1
+#define CONTAINER_HEADERBYTES   32
+#define CONTAINER_TAGBYTES      16
+#define CONTAINER_KEYBYTES      16
+#define CONTAINER_NONCEBYTES    8
+#define CONTAINER_CHUNKBYTES    (1 << 20)   // default chunk size
+
+typedef struct {
+    uint32_t chunk_size;
+    uint64_t length;
+    uint64_t nchunks;
+    uint8_t base_nonce[CONTAINER_NONCEBYTES];
+    uint8_t raw[CONTAINER_HEADERBYTES];     // encoded header (authenticated)
+} container_header;
+
+/**
+ * Initialize (and encode) the header of a container of 'length' bytes.
+ * Returns -1 if 'chunk_size' is zero.
+ */
+int container_header_init(container_header *hdr, uint32_t chunk_size,
+    uint64_t length, const uint8_t base_nonce[CONTAINER_NONCEBYTES]);
+
+/**
+ * Decode the header from 'buf' and check that a container of 'size' bytes is
+ * consistent with it. Returns -1 if it is not a valid container.
+ */
+int container_header_parse(container_header *hdr, const uint8_t *buf,
+    uint64_t size);
+
+// Total size of the container, offset of its ciphertext and size of chunk 'i'
+uint64_t container_size(const container_header *hdr);
+uint64_t container_data_offset(const container_header *hdr);
+size_t container_chunk_len(const container_header *hdr, uint64_t i);
+
+/**
+ * Encrypt chunk 'i' from 'm' into 'c' (which may be equal) and write its tag.
+ */
+void container_seal_chunk(const container_header *hdr,
+    const uint8_t key[CONTAINER_KEYBYTES], uint64_t i,
+    uint8_t *c, uint8_t tag[CONTAINER_TAGBYTES], const uint8_t *m);
+
+/**
+ * Decrypt chunk 'i' from 'c' into 'm' (which may be equal).
+ * Returns a non-zero value if the tag verification fails.
+ */
+int container_open_chunk(const container_header *hdr,
+    const uint8_t key[CONTAINER_KEYBYTES], uint64_t i,
+    uint8_t *m, const uint8_t *c, const uint8_t tag[CONTAINER_TAGBYTES]);
+
+#endif  // CONTAINER_H_
@@ -0,0 +1,326 @@
+/******************************************************************************
+ * Parallel encryption/decryption of files into seekable Romulus-N containers
+ * (see 'container.h' for the format).
+ *
+ * Input and output files are memory-mapped and the chunks are processed by a
+ * pool of threads, each of them picking the next chunk index from a shared
+ * counter. With '-r offset:length', only the chunks covering the requested
+ * plaintext range are authenticated and decrypted.
+ *
+ * The key file contains the 16-byte key. If any chunk fails to authenticate,
+ * the output file is removed and the index of the first failing chunk is
+ * reported.
+ *
+ * Usage: romulus-crypt encrypt -k keyfile [-c chunk_size] [-t threads] in out
+ *        romulus-crypt decrypt -k keyfile [-r offset:length] [-t threads] in out
+ *
+ * @date        October 2026
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "container.h"
+
+typedef struct {
+    const container_header *hdr;
+    const uint8_t *key;
+    const uint8_t *in;          // plaintext (encryption) or container
+    uint8_t *out;               // container (encryption) or plaintext
+    uint64_t first, last;       // chunks to process (inclusive)
+    uint64_t offset, length;    // plaintext range to output
+    atomic_uint_fast64_t next;  // next chunk to process
+    atomic_uint_fast64_t fail;  // first chunk which failed to authenticate
+    atomic_int oom;             // a worker could not allocate its buffer
+    int encrypt;
+} job;
+
+static const char *prog = "romulus-crypt";
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: %s encrypt -k keyfile [-c chunk_size] [-t threads] in out\n"
+        "       %s decrypt -k keyfile [-r offset:length] [-t threads] in out\n",
+        prog, prog);
+    exit(2);
+}
+
+/**
+ * Parse a size with an optional 'k', 'm' or 'g' suffix (powers of 1024).
+ */
+static int parse_size(const char *s, char **end, uint64_t *x)
+{
+    errno = 0;
+    *x = strtoull(s, end, 0);
+    if (errno || *end == s || *s == '-')
+        return -1;
+    switch (**end) {
+        case 'k': case 'K': *x <<= 10; (*end)++; break;
+        case 'm': case 'M': *x <<= 20; (*end)++; break;
+        case 'g': case 'G': *x <<= 30; (*end)++; break;
+    }
+    return 0;
+}
+
+static int read_all(const char *path, uint8_t *buf, size_t len)
+{
+    int fd;
+    ssize_t r;
+    size_t n = 0;
+    if ((fd = open(path, O_RDONLY)) < 0)
+        return -1;
+    while (n < len && (r = read(fd, buf + n, len - n)) > 0)
+        n += r;
+    close(fd);
+    return (n == len) ? 0 : -1;
+}
+
+/**
+ * Map 'len' bytes of 'fd' (or nothing if 'len' is zero, which mmap rejects).
+ */
+static uint8_t *map(int fd, uint64_t len, int writable)
+{
+    void *p;
+    if (len == 0)
+        return NULL;
+    if (len > SIZE_MAX)
+        return MAP_FAILED;
+    p = mmap(NULL, len, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+        MAP_SHARED, fd, 0);
+    return (uint8_t *)p;
+}
+
+static void process_chunk(job *j, uint64_t i, uint8_t *buf)
+{
+    const container_header *hdr = j->hdr;
+    uint64_t data = container_data_offset(hdr);
+    uint64_t off = i * hdr->chunk_size;
+    size_t len = container_chunk_len(hdr, i);
+    uint64_t lo, hi;
+    uint8_t *m;
+    if (j->encrypt) {
+        container_seal_chunk(hdr, j->key, i, j->out + data + off,
+            j->out + CONTAINER_HEADERBYTES + CONTAINER_TAGBYTES*i,
+            j->in + off);
+        return;
+    }
+    // full decryption goes directly to the output, ranges through 'buf'
+    m = buf ? buf : j->out + off;
+    if (container_open_chunk(hdr, j->key, i, m, j->in + data + off,
+        j->in + CONTAINER_HEADERBYTES + CONTAINER_TAGBYTES*i)) {
+        memset(m, 0x00, len);
+        uint_fast64_t cur = atomic_load(&j->fail);
+        while (i < cur && !atomic_compare_exchange_weak(&j->fail, &cur, i));
+        return;
+    }
+    if (buf) {
+        lo = (off > j->offset) ? off : j->offset;
+        hi = (off + len < j->offset + j->length) ? off + len :
+            j->offset + j->length;
+        memcpy(j->out + (lo - j->offset), buf + (lo - off), hi - lo);
+    }
+}
+
+static void *worker(void *arg)
+{
+    job *j = (job *)arg;
+    uint8_t *buf = NULL;
+    uint64_t i;
+    if (!j->encrypt && j->length != j->hdr->length) {
+        buf = malloc(j->hdr->chunk_size);
+        if (!buf) {
+            atomic_store(&j->oom, 1);
+            return NULL;
+        }
+    }
+    while ((i = atomic_fetch_add(&j->next, 1)) <= j->last)
+        process_chunk(j, i, buf);
+    if (buf) {
+        memset(buf, 0x00, j->hdr->chunk_size);
+        free(buf);
+    }
+    return NULL;
+}
+
+static int run(job *j, int nthreads)
+{
+    pthread_t *th;
+    int tid, n;
+    if ((uint64_t)nthreads > j->last - j->first + 1)
+        nthreads = (int)(j->last - j->first + 1);
+    atomic_init(&j->next, j->first);
+    atomic_init(&j->fail, UINT64_MAX);
+    atomic_init(&j->oom, 0);
+    th = calloc(nthreads, sizeof(pthread_t));
+    if (!th)
+        return -1;
+    for (n = 0; n < nthreads; n++)
+        if (pthread_create(&th[n], NULL, worker, j))
+            break;
+    if (n == 0)
+        worker(j);
+    for (tid = 0; tid < n; tid++)
+        pthread_join(th[tid], NULL);
+    free(th);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    container_header hdr;
+    uint8_t key[CONTAINER_KEYBYTES];
+    uint8_t nonce[CONTAINER_NONCEBYTES];
+    uint64_t chunk_size = CONTAINER_CHUNKBYTES;
+    uint64_t insize = 0, outsize = 0;
+    uint64_t offset = 0, length = 0;
+    const char *keyfile = NULL;
+    char *end;
+    int opt, encrypt, range = 0, ret = 1;
+    int fdin = -1, fdout = -1;
+    long nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+    struct stat st;
+    uint8_t *in = NULL, *out = NULL;
+    job j;
+
+    if (argc < 2)
+        usage();
+    if (!strcmp(argv[1], "encrypt"))
+        encrypt = 1;
+    else if (!strcmp(argv[1], "decrypt"))
+        encrypt = 0;
+    else
+        usage();
+    argv++;
+    argc--;
+    while ((opt = getopt(argc, argv, "k:c:t:r:")) != -1) {
+        switch (opt) {
+            case 'k': keyfile = optarg; break;
+            case 'c':
+                if (!encrypt || parse_size(optarg, &end, &chunk_size) || *end ||
+                    chunk_size == 0 || chunk_size > UINT32_MAX)
+                    usage();
+                break;
+            case 't': nthreads = strtol(optarg, &end, 10);
+                if (*end || nthreads < 1)
+                    usage();
+                break;
+            case 'r':
+                if (encrypt || parse_size(optarg, &end, &offset) ||
+                    *end != ':' || parse_size(end + 1, &end, &length) || *end)
+                    usage();
+                range = 1;
+                break;
+            default: usage();
+        }
+    }
+    if (!keyfile || argc - optind != 2)
+        usage();
+    if (nthreads < 1)
+        nthreads = 1;
+    if (read_all(keyfile, key, sizeof(key))) {
+        fprintf(stderr, "%s: cannot read the key from '%s'\n", prog, keyfile);
+        return 1;
+    }
+
+    if ((fdin = open(argv[optind], O_RDONLY)) < 0 || fstat(fdin, &st)) {
+        perror(argv[optind]);
+        goto done;
+    }
+    insize = (uint64_t)st.st_size;
+    if ((in = map(fdin, insize, 0)) == MAP_FAILED) {
+        perror(argv[optind]);
+        goto done;
+    }
+    if (encrypt) {
+        if (read_all("/dev/urandom", nonce, sizeof(nonce))) {
+            fprintf(stderr, "%s: cannot generate a nonce\n", prog);
+            goto done;
+        }
+        container_header_init(&hdr, (uint32_t)chunk_size, insize, nonce);
+        outsize = container_size(&hdr);
+        offset = 0;
+        length = insize;
+    } else {
+        if (container_header_parse(&hdr, in, insize)) {
+            fprintf(stderr, "%s: '%s' is not a valid container\n", prog,
+                argv[optind]);
+            goto done;
+        }
+        if (!range) {
+            offset = 0;
+            length = hdr.length;
+        } else if (offset > hdr.length || length > hdr.length - offset) {
+            fprintf(stderr, "%s: range out of bounds (%llu bytes)\n", prog,
+                (unsigned long long)hdr.length);
+            goto done;
+        }
+        outsize = length;
+    }
+
+    fdout = open(argv[optind+1], O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fdout < 0 || ftruncate(fdout, (off_t)outsize)) {
+        perror(argv[optind+1]);
+        goto done;
+    }
+    if ((out = map(fdout, outsize, 1)) == MAP_FAILED) {
+        perror(argv[optind+1]);
+        goto done;
+    }
+    if (encrypt)
+        memcpy(out, hdr.raw, CONTAINER_HEADERBYTES);
+
+    j.hdr = &hdr;
+    j.key = key;
+    j.in = in;
+    j.out = out;
+    j.encrypt = encrypt;
+    j.offset = offset;
+    j.length = length;
+    if (encrypt || !range) {
+        j.first = 0;
+        j.last = hdr.nchunks - 1;
+    } else if (length == 0) {
+        ret = 0;
+        goto done;
+    } else {
+        j.first = offset / hdr.chunk_size;
+        j.last = (offset + length - 1) / hdr.chunk_size;
+    }
+    if (run(&j, (int)nthreads) || atomic_load(&j.oom)) {
+        fprintf(stderr, "%s: cannot start the workers\n", prog);
+        goto done;
+    }
+    if (atomic_load(&j.fail) != UINT64_MAX) {
+        fprintf(stderr, "%s: authentication failed for chunk %llu\n", prog,
+            (unsigned long long)atomic_load(&j.fail));
+        goto done;
+    }
+    if (out && msync(out, outsize, MS_SYNC)) {
+        perror(argv[optind+1]);
+        goto done;
+    }
+    ret = 0;
+
+done:
+    memset(key, 0x00, sizeof(key));
+    if (in && in != MAP_FAILED)
+        munmap(in, insize);
+    if (out && out != MAP_FAILED)
+        munmap(out, outsize);
+    if (fdin >= 0)
+        close(fdin);
+    if (fdout >= 0) {
+        close(fdout);
+        if (ret)
+            unlink(argv[optind+1]);
+    }
+    return ret;
+}